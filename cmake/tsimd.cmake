@@ -78,4 +78,30 @@ macro(tsimd_configure_compiler)
   endif()
 endmacro()
 
+## Runtime ISA dispatch macro ##
+
+# Compiles each given source once per dispatch ISA with that ISA's flags
+# (FLAGS_* from the compiler's cmake/ file), appending the generated sources to
+# the list named by OUT_VAR. See tsimd/detail/dispatch.h for the source side.
+#
+# NOTE: ISAs below TSIMD_BUILD_ISA still get the baseline flags from
+#       CMAKE_CXX_FLAGS, which is fine as the binary requires that ISA anyway
+macro(tsimd_dispatch_sources OUT_VAR)
+  foreach(src ${ARGN})
+    get_filename_component(src_path ${src} ABSOLUTE)
+    get_filename_component(src_name ${src} NAME_WE)
+    foreach(isa SSE42 AVX AVX2 AVX512KNL AVX512SKX)
+      string(TOLOWER ${isa} isa_name)
+      set(isa_src ${CMAKE_CURRENT_BINARY_DIR}/${src_name}_${isa_name}.cpp)
+      file(WRITE ${isa_src}.in
+           "#define TSIMD_DISPATCH_ISA ${isa_name}\n"
+           "#include \"${src_path}\"\n")
+      configure_file(${isa_src}.in ${isa_src} COPYONLY)
+      set_source_files_properties(${isa_src} PROPERTIES
+                                  COMPILE_FLAGS "${FLAGS_${isa}}")
+      list(APPEND ${OUT_VAR} ${isa_src})
+    endforeach()
+  endforeach()
+endmacro()
+
 include(clang-format)
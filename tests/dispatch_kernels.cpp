@@ -0,0 +1,55 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+
+// NOTE: built once per ISA by tsimd_dispatch_sources() in tests/CMakeLists.txt
+
+#include "tsimd/tsimd.h"
+
+namespace {
+
+  template <int W>
+  int saxpy(float a, const float *x, float *y, int n)
+  {
+    using vfloatn = tsimd::pack<float, W>;
+
+    int i = 0;
+
+    for (; i + W <= n; i += W) {
+      auto vx = tsimd::load<vfloatn>(x + i);
+      auto vy = tsimd::load<vfloatn>(y + i);
+      tsimd::store(a * vx + vy, y + i);
+    }
+
+    for (; i < n; ++i)
+      y[i] = a * x[i] + y[i];
+
+    return W;
+  }
+
+}  // namespace
+
+TSIMD_DISPATCH_TARGET(saxpy,
+                      saxpy<TSIMD_DEFAULT_WIDTH>,
+                      int(float, const float *, float *, int))
@@ -0,0 +1,379 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+// Sweeps float32 inputs through each accuracy tier of the math functions,
+// checking the max error against the documented bound and reporting the
+// throughput of each tier.
+//
+//   usage: test_accuracy [stride] [function]
+//
+// Every 'stride'-th bit pattern is tested, the default of 1 being the
+// exhaustive sweep, optionally only for functions starting with 'function'.
+// Returns non-zero if any bound is exceeded.
+
+#include "tsimd/tsimd.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+using vfloat = tsimd::vfloat;
+
+static const int W = vfloat::static_size;
+
+static const float flt_min = std::numeric_limits<float>::min();
+static const float flt_max = std::numeric_limits<float>::max();
+
+struct sweep
+{
+  const char *name;
+  const char *tier;
+  const char *domain;
+  bool (*in_domain)(float);
+  double bound;
+  vfloat (*fcn)(const vfloat &);
+  double (*reference)(double);
+};
+
+// Domains //
+
+static bool all(float)
+{
+  return true;
+}
+
+static bool positive_normal(float x)
+{
+  return x >= flt_min && x <= flt_max;
+}
+
+static bool exp_range(float x)
+{
+  return x >= -87.3f && x <= 88.3f;
+}
+
+static bool trig_range(float x)
+{
+  return std::abs(x) < 6433.f;
+}
+
+static bool sqrt_range(float x)
+{
+  return x == 0.f || positive_normal(x);
+}
+
+static bool rcp_range(float x)
+{
+  return std::abs(x) >= flt_min && std::abs(x) < std::ldexp(1.f, 126);
+}
+
+static bool gamma_range(float x)
+{
+  return x >= 1.f / 65536.f && x <= 65536.f;
+}
+
+// References, in double precision //
+
+static double exp_ref(double x)
+{
+  return std::exp(x);
+}
+
+static double log_ref(double x)
+{
+  return std::log(x);
+}
+
+static double sin_ref(double x)
+{
+  return std::sin(x);
+}
+
+static double cos_ref(double x)
+{
+  return std::cos(x);
+}
+
+static double tan_ref(double x)
+{
+  return std::tan(x);
+}
+
+static double atan_ref(double x)
+{
+  return std::atan(x);
+}
+
+static double asin_ref(double x)
+{
+  return std::asin(x);
+}
+
+static double acos_ref(double x)
+{
+  return std::acos(x);
+}
+
+static double sinh_ref(double x)
+{
+  return std::sinh(x);
+}
+
+static double cosh_ref(double x)
+{
+  return std::cosh(x);
+}
+
+static double tanh_ref(double x)
+{
+  return std::tanh(x);
+}
+
+static double atan2_ref(double y)
+{
+  return std::atan2(y, -2.0);
+}
+
+static double sqrt_ref(double x)
+{
+  return std::sqrt(x);
+}
+
+static double rcp_ref(double x)
+{
+  return 1.0 / x;
+}
+
+static double rsqrt_ref(double x)
+{
+  return 1.0 / std::sqrt(x);
+}
+
+static double div_ref(double x)
+{
+  return 1.75 / x;
+}
+
+static double gamma_ref(double x)
+{
+  return std::pow(x, double(2.4f));
+}
+
+static double inv_gamma_ref(double x)
+{
+  return std::pow(x, double(1.f / 2.4f));
+}
+
+#define TIERS(NAME, REF, FAST_DOMAIN, FAST_IN_DOMAIN, FAST, DEFAULT, PRECISE) \
+  {#NAME, "fast", FAST_DOMAIN, FAST_IN_DOMAIN, FAST,                       \
+   [](const vfloat &x) { return tsimd::fast::NAME(x); }, REF},             \
+  {#NAME, "default", "all", all, DEFAULT,                                  \
+   [](const vfloat &x) { return tsimd::NAME(x); }, REF},                   \
+  {#NAME, "precise", "all", all, PRECISE,                                  \
+   [](const vfloat &x) { return tsimd::precise::NAME(x); }, REF}
+
+static const sweep sweeps[] = {
+    TIERS(exp, exp_ref, "[-87.3, 88.3]", exp_range, 1.5, 1.5, 1.0),
+    TIERS(log, log_ref, "normal > 0", positive_normal, 1.0, 1.0, 1.0),
+    TIERS(sin, sin_ref, "|x| < 6433", trig_range, 2.5, 2.5, 1.0),
+    TIERS(cos, cos_ref, "|x| < 6433", trig_range, 2.5, 2.5, 1.0),
+    {"sincos sin", "default", "all", all, 2.5,
+     [](const vfloat &x) {
+       vfloat s, c;
+       tsimd::sincos(x, s, c);
+       return s;
+     },
+     sin_ref},
+    {"sincos cos", "default", "all", all, 2.5,
+     [](const vfloat &x) {
+       vfloat s, c;
+       tsimd::sincos(x, s, c);
+       return c;
+     },
+     cos_ref},
+    TIERS(tan, tan_ref, "|x| < 6433", trig_range, 4.0, 4.0, 1.0),
+    {"atan", "default", "all", all, 2.5,
+     [](const vfloat &x) { return tsimd::atan(x); }, atan_ref},
+    {"atan2(x,-2)", "default", "all", all, 3.0,
+     [](const vfloat &y) { return tsimd::atan2(y, vfloat(-2.f)); },
+     atan2_ref},
+    {"asin", "default", "all", all, 2.5,
+     [](const vfloat &x) { return tsimd::asin(x); }, asin_ref},
+    {"acos", "default", "all", all, 2.0,
+     [](const vfloat &x) { return tsimd::acos(x); }, acos_ref},
+    {"sinh", "default", "all", all, 2.0,
+     [](const vfloat &x) { return tsimd::sinh(x); }, sinh_ref},
+    {"cosh", "default", "all", all, 2.0,
+     [](const vfloat &x) { return tsimd::cosh(x); }, cosh_ref},
+    {"tanh", "default", "all", all, 2.0,
+     [](const vfloat &x) { return tsimd::tanh(x); }, tanh_ref},
+    TIERS(sqrt, sqrt_ref, "0, normal > 0", sqrt_range, 3.0, 0.5, 0.5),
+    TIERS(rcp, rcp_ref, "normal < 2^126", rcp_range, 3.0, 0.5, 0.5),
+    {"rcp<0>", "N = 0", "normal < 2^126", rcp_range, 6144.0,
+     [](const vfloat &x) { return tsimd::rcp<0>(x); }, rcp_ref},
+    {"rcp<1>", "N = 1", "normal < 2^126", rcp_range, 3.0,
+     [](const vfloat &x) { return tsimd::rcp<1>(x); }, rcp_ref},
+    {"rcp<2>", "N = 2", "normal < 2^126", rcp_range, 1.5,
+     [](const vfloat &x) { return tsimd::rcp<2>(x); }, rcp_ref},
+    {"rsqrt<0>", "N = 0", "normal > 0", positive_normal, 6144.0,
+     [](const vfloat &x) { return tsimd::rsqrt<0>(x); }, rsqrt_ref},
+    {"rsqrt<1>", "N = 1", "normal > 0", positive_normal, 3.5,
+     [](const vfloat &x) { return tsimd::rsqrt<1>(x); }, rsqrt_ref},
+    {"rsqrt<2>", "N = 2", "normal > 0", positive_normal, 1.5,
+     [](const vfloat &x) { return tsimd::rsqrt<2>(x); }, rsqrt_ref},
+    {"fast_div<0>", "N = 0", "normal < 2^126", rcp_range, 6144.5,
+     [](const vfloat &x) { return tsimd::fast_div<0>(vfloat(1.75f), x); },
+     div_ref},
+    {"fast_div<1>", "N = 1", "normal < 2^126", rcp_range, 3.5,
+     [](const vfloat &x) { return tsimd::fast_div<1>(vfloat(1.75f), x); },
+     div_ref},
+    {"fast_div<2>", "N = 2", "normal < 2^126", rcp_range, 2.0,
+     [](const vfloat &x) { return tsimd::fast_div<2>(vfloat(1.75f), x); },
+     div_ref},
+    {"pow(x,2.4)", "fast", "[2^-16, 2^16]", gamma_range, 41.0,
+     [](const vfloat &x) { return tsimd::fast::pow(x, 2.4f); }, gamma_ref},
+    {"pow(x,2.4)", "default", "all", all, 1.0,
+     [](const vfloat &x) { return tsimd::pow(x, 2.4f); }, gamma_ref},
+    {"pow(x,2.4)", "precise", "all", all, 1.0,
+     [](const vfloat &x) { return tsimd::precise::pow(x, 2.4f); },
+     gamma_ref},
+    {"pow(x,1/2.4)", "fast", "[2^-16, 2^16]", gamma_range, 8.0,
+     [](const vfloat &x) { return tsimd::fast::pow(x, 1.f / 2.4f); },
+     inv_gamma_ref},
+    {"pow(x,1/2.4)", "default", "all", all, 1.0,
+     [](const vfloat &x) { return tsimd::pow(x, 1.f / 2.4f); },
+     inv_gamma_ref},
+    {"pow(x,1/2.4)", "precise", "all", all, 1.0,
+     [](const vfloat &x) { return tsimd::precise::pow(x, 1.f / 2.4f); },
+     inv_gamma_ref}};
+
+#undef TIERS
+
+// Error of a float result in ulps of the reference
+static double ulp_error(float result, double reference)
+{
+  if (std::isnan(reference))
+    return std::isnan(result) ? 0.0 : HUGE_VAL;
+
+  if (std::isnan(result))
+    return HUGE_VAL;
+
+  // Overflow is exact if the reference rounds to infinity as well,
+  // otherwise infinity counts as one ulp past the largest float (2^128)
+  if (std::isinf(result) && float(reference) == result)
+    return 0.0;
+
+  double r = result;
+  if (std::isinf(result))
+    r = std::copysign(std::ldexp(1.0, 128), r);
+  else if (std::isinf(reference))
+    return HUGE_VAL;
+
+  int e;
+  std::frexp(reference, &e);
+  const double ulp = std::ldexp(1.0, std::max(e - 24, -149));
+  return std::abs(r - reference) / ulp;
+}
+
+int main(int argc, const char *argv[])
+{
+  const uint64_t stride = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1;
+
+  const char *only  = argc > 2 ? argv[2] : "";
+
+  if (stride == 0) {
+    std::fprintf(stderr, "usage: %s [stride] [function]\n", argv[0]);
+    return 1;
+  }
+
+  std::printf("float32 sweep, stride %llu, width %d\n\n",
+              (unsigned long long)stride,
+              W);
+  std::printf("%-13s %-8s %-16s %12s %8s %10s\n",
+              "function", "tier", "domain", "max error", "bound", "Mvals/s");
+
+  static const size_t chunk = 1 << 16;
+  TSIMD_ALIGN(64) static float in[chunk + W];
+  TSIMD_ALIGN(64) static float out[chunk + W];
+
+  int failures = 0;
+
+  for (const sweep &s : sweeps) {
+    if (std::strncmp(s.name, only, std::strlen(only)) != 0)
+      continue;
+
+    double max_error = 0.0;
+    float worst      = 0.f;
+    double seconds   = 0.0;
+    uint64_t count   = 0;
+
+    uint64_t bits = 0;
+    while (bits < (uint64_t(1) << 32)) {
+      size_t n = 0;
+      for (; n < chunk && bits < (uint64_t(1) << 32); bits += stride) {
+        const uint32_t b = uint32_t(bits);
+        float x;
+        std::memcpy(&x, &b, sizeof(x));
+        if (s.in_domain(x))
+          in[n++] = x;
+      }
+
+      for (size_t i = n; i % W; ++i)
+        in[i] = 1.f;
+
+      const auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < n; i += W)
+        tsimd::store(s.fcn(tsimd::load<vfloat>(&in[i])), &out[i]);
+      const auto end = std::chrono::steady_clock::now();
+
+      seconds += std::chrono::duration<double>(end - start).count();
+      count += n;
+
+      for (size_t i = 0; i < n; ++i) {
+        const double error =
+            ulp_error(out[i], s.reference(in[i]));
+        if (!(error <= max_error)) {
+          max_error = error;
+          worst     = in[i];
+        }
+      }
+    }
+
+    const bool pass = max_error <= s.bound;
+    failures += !pass;
+
+    std::printf("%-13s %-8s %-16s %12.3f %8.1f %10.1f%s",
+                s.name, s.tier, s.domain, max_error, s.bound,
+                count / seconds * 1e-6, pass ? "\n" : "  FAILED");
+    if (!pass)
+      std::printf(" at x = %a\n", worst);
+  }
+
+  return failures == 0 ? 0 : 1;
+}
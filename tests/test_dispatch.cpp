@@ -0,0 +1,69 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+
+#include "catch/catch.hpp"
+
+#include "tsimd/tsimd.h"
+
+#include <string>
+
+// NOTE: returns the width of the variant which ran
+TSIMD_DISPATCH(saxpy, int(float, const float *, float *, int));
+
+TEST_CASE("cpu_isa()", "[dispatch]")
+{
+  const tsimd::isa detected = tsimd::cpu_isa();
+
+  REQUIRE(detected == tsimd::cpu_isa());
+  REQUIRE(std::string(tsimd::isa_name(detected)) != "unknown");
+}
+
+TEST_CASE("dispatched kernel", "[dispatch]")
+{
+  const int n = 100;
+  TSIMD_ALIGN(64) float x[n];
+  TSIMD_ALIGN(64) float y[n];
+
+  for (int i = 0; i < n; ++i) {
+    x[i] = float(i);
+    y[i] = 1.f;
+  }
+
+  const int width = saxpy(2.f, x, y, n);
+
+  for (int i = 0; i < n; ++i)
+    REQUIRE(y[i] == 2.f * i + 1.f);
+
+  const tsimd::isa detected = tsimd::cpu_isa();
+
+  if (detected >= tsimd::isa::avx512knl)
+    REQUIRE(width == 16);
+  else if (detected >= tsimd::isa::avx)
+    REQUIRE(width == 8);
+  else
+    REQUIRE(width >= 4);
+
+  REQUIRE(saxpy.get() == saxpy.get());
+}
@@ -27,6 +27,8 @@
 #include "tsimd/tsimd.h"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <numeric>
 #include <random>
 
@@ -52,9 +54,19 @@ using vbool  = tsimd::pack<bool_type, TEST_WIDTH>;
 using vfloat = tsimd::pack<float_type, TEST_WIDTH>;
 using vint   = tsimd::pack<int_type, TEST_WIDTH>;
 
+using vuint    = tsimd::pack<unsigned int, TEST_WIDTH>;
+using vsingle  = tsimd::pack<float, TEST_WIDTH>;
+
+// 8/16-bit packs fill the same register as TEST_WIDTH 32-bit elements
+#define TEST_WIDTH_8BIT (TEST_WIDTH == 1 ? 1 : TEST_WIDTH * 4)
+#define TEST_WIDTH_16BIT (TEST_WIDTH == 1 ? 1 : TEST_WIDTH * 2)
+
+using vschar  = tsimd::pack<int8_t, TEST_WIDTH_8BIT>;
+using vuchar  = tsimd::pack<uint8_t, TEST_WIDTH_8BIT>;
+using vshort  = tsimd::pack<int16_t, TEST_WIDTH_16BIT>;
+using vushort = tsimd::pack<uint16_t, TEST_WIDTH_16BIT>;
+
 /* TODO: add tests for -->
- *         - operator<<()
- *         - operator>>()
  *         - operator^()
  *         - load()
  *         - store()
@@ -69,6 +81,33 @@ TEST_CASE("cast construction", "[member_functions]")
   REQUIRE(tsimd::all(vint(v1) == 3));
 }
 
+TEST_CASE("unsigned int <--> float conversion", "[member_functions]")
+{
+  vuint v1(0x87654321u);
+  vsingle v2(4000000000.f);
+  vsingle v3(3.5f);
+
+  REQUIRE(tsimd::all(vsingle(v1) == float(0x87654321u)));
+  REQUIRE(tsimd::all(vuint(v2) == 4000000000u));
+  REQUIRE(tsimd::all(vuint(v3) == 3u));
+  REQUIRE(tsimd::all(vuint(vsingle(vuint(7u))) == 7u));
+}
+
+TEST_CASE("8/16-bit integer <--> int conversion", "[member_functions]")
+{
+  tsimd::vshort8 s1(-3);
+  tsimd::vushort8 s2(uint16_t(65535));
+  tsimd::vint16 i1(300);
+
+  REQUIRE(tsimd::all(tsimd::vint8(s1) == tsimd::vint8(-3)));
+  REQUIRE(tsimd::all(tsimd::vint8(s2) == tsimd::vint8(65535)));
+  REQUIRE(tsimd::all(tsimd::vshort8(tsimd::vint8(-70000)) ==
+                     tsimd::vshort8(int16_t(-4464))));
+  REQUIRE(tsimd::all(tsimd::vuchar16(i1) == tsimd::vuchar16(uint8_t(44))));
+  REQUIRE(tsimd::all(tsimd::vint16(tsimd::vschar16(int8_t(-100))) ==
+                     tsimd::vint16(-100)));
+}
+
 // pack<> arithmetic operators ////////////////////////////////////////////////
 
 TEST_CASE("binary operator+()", "[arithmetic_operators]")
@@ -199,6 +238,124 @@ TEST_CASE("binary operator%=()", "[arithmetic_operators]")
   REQUIRE(tsimd::all(v2 == vint(1)));
 }
 
+TEST_CASE("32-bit integer division", "[arithmetic_operators]")
+{
+  using vint32 = tsimd::pack<int, TEST_WIDTH>;
+
+  const int n[] = {2147483647, -2147483647, 1000000007, -99, 7, 0};
+  const int d[] = {1, -1, 3, -7, 46341, -2147483647 - 1};
+
+  for (int i : n) {
+    for (int j : d) {
+      REQUIRE(tsimd::all((vint32(i) / vint32(j)) == (i / j)));
+      REQUIRE(tsimd::all((vint32(i) % vint32(j)) == (i % j)));
+    }
+  }
+
+  REQUIRE(tsimd::all((vuint(4294967295u) / vuint(3u)) == 1431655765u));
+  REQUIRE(tsimd::all((vuint(4294967295u) / vuint(4294967294u)) == 1u));
+  REQUIRE(tsimd::all((vuint(4294967295u) % vuint(10u)) == 5u));
+}
+
+TEST_CASE("divider", "[arithmetic_operators]")
+{
+  using vint32 = tsimd::pack<int, TEST_WIDTH>;
+
+  vint32 n;
+  vuint u;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    n[i] = (i % 2 ? -1 : 1) * (i * 104729 + 17);
+    u[i] = 4294967295u - unsigned(i) * 2654435761u;
+  }
+
+  n[0] = 2147483647;
+  n[TEST_WIDTH - 1] = -2147483647;
+
+  const int d[] = {1, -1, 2, 3, -3, 7, 10, -16, 641, 65536, 2147483647, -2};
+
+  for (int j : d) {
+    tsimd::divider<int, TEST_WIDTH> div(j);
+
+    const vint32 q = n / div;
+    const vint32 r = n % div;
+
+    for (int i = 0; i < TEST_WIDTH; ++i) {
+      REQUIRE(q[i] == n[i] / j);
+      REQUIRE(r[i] == n[i] % j);
+    }
+  }
+
+  const unsigned int ud[] = {
+      1u, 2u, 3u, 7u, 10u, 641u, 65536u, 2147483647u, 2147483648u, 4294967295u};
+
+  for (unsigned int j : ud) {
+    tsimd::divider<unsigned int, TEST_WIDTH> div(j);
+
+    vuint q = u;
+    q /= div;
+
+    for (int i = 0; i < TEST_WIDTH; ++i) {
+      REQUIRE(q[i] == u[i] / j);
+      REQUIRE((u % div)[i] == u[i] % j);
+    }
+  }
+}
+
+TEST_CASE("unsigned arithmetic operators", "[arithmetic_operators]")
+{
+  vuint v1(0u), v2(1u), v3(4000000000u);
+
+  REQUIRE(tsimd::all((v1 - v2) == 0xffffffffu));
+  REQUIRE(tsimd::all((v3 + v3) == 3705032704u));
+  REQUIRE(tsimd::all((v3 * 2u) == 3705032704u));
+  REQUIRE(tsimd::all((v3 / 2u) == 2000000000u));
+}
+
+TEST_CASE("8/16-bit arithmetic operators", "[arithmetic_operators]")
+{
+  vschar c1(int8_t(100)), c2(int8_t(50));
+  vuchar u1(uint8_t(250)), u2(uint8_t(10));
+  vshort s1(int16_t(300)), s2(int16_t(-7));
+  vushort w1(uint16_t(60000));
+
+  REQUIRE(tsimd::all((c1 + c2) == vschar(int8_t(-106))));
+  REQUIRE(tsimd::all((u1 + u2) == vuchar(uint8_t(4))));
+  REQUIRE(tsimd::all((u2 - u1) == vuchar(uint8_t(16))));
+  REQUIRE(tsimd::all((s1 * s2) == vshort(int16_t(-2100))));
+  REQUIRE(tsimd::all((w1 + w1) == vushort(uint16_t(54464))));
+}
+
+TEST_CASE("saturating arithmetic", "[arithmetic_operators]")
+{
+  vschar c1(int8_t(100)), c2(int8_t(50));
+  vuchar u1(uint8_t(250)), u2(uint8_t(10));
+  vshort s1(int16_t(30000));
+  vushort w1(uint16_t(60000)), w2(uint16_t(7));
+
+  REQUIRE(tsimd::all(tsimd::adds(c1, c2) == vschar(int8_t(127))));
+  REQUIRE(tsimd::all(tsimd::subs(-c1, c2) == vschar(int8_t(-128))));
+  REQUIRE(tsimd::all(tsimd::adds(u1, u2) == vuchar(uint8_t(255))));
+  REQUIRE(tsimd::all(tsimd::subs(u2, u1) == vuchar(uint8_t(0))));
+  REQUIRE(tsimd::all(tsimd::adds(s1, s1) == vshort(int16_t(32767))));
+  REQUIRE(tsimd::all(tsimd::avg(w1, w2) == vushort(uint16_t(30004))));
+  REQUIRE(tsimd::all(tsimd::mulhi(w1, w1) == vushort(uint16_t(54931))));
+  REQUIRE(tsimd::all(tsimd::mulhi(s1, -s1) == vshort(int16_t(-13733))));
+}
+
+TEST_CASE("composite width arithmetic operators", "[arithmetic_operators]")
+{
+  tsimd::vdouble2 d1(1.5), d2(2.0);
+  tsimd::vfloat32 f1(3.f), f2(0.5f);
+  tsimd::vllong32 l1(1ll << 40), l2(3ll);
+  tsimd::vint64 i1(7);
+
+  REQUIRE(tsimd::all((d1 * d2) == 3.0));
+  REQUIRE(tsimd::all((f1 / f2 - f1) == 3.f));
+  REQUIRE(tsimd::all((l1 * l2 + l2) == 3298534883331ll));
+  REQUIRE(tsimd::all((i1 + i1) == 14));
+}
+
 // pack<> bitwise operators ///////////////////////////////////////////////////
 
 TEST_CASE("binary operator<<()", "[bitwise_operators]")
@@ -231,6 +388,54 @@ TEST_CASE("binary operator^()", "[bitwise_operators]")
   REQUIRE(tsimd::all((2 ^ v1) == vint(3)));
 }
 
+TEST_CASE("unsigned shift operators", "[bitwise_operators]")
+{
+  vuint v1(0x80000000u);
+  vuint v2(31u);
+
+  REQUIRE(tsimd::all((v1 >> v2) == 1u));
+  REQUIRE(tsimd::all((v1 >> 4) == 0x08000000u));
+  REQUIRE(tsimd::all((v1 << 1) == 0u));
+  REQUIRE(tsimd::all((vuint(1u) << v2) == v1));
+}
+
+TEST_CASE("srl()/sra()", "[bitwise_operators]")
+{
+  vint v1(-16);
+  vint n;
+  std::iota(n.begin(), n.end(), 0);
+
+  REQUIRE(tsimd::all(tsimd::sra(v1, 2) == vint(-4)));
+  REQUIRE(tsimd::all(tsimd::srl(v1, 8 * sizeof(int_type) - 1) == vint(1)));
+  REQUIRE(tsimd::all(tsimd::srl(vuint(0x80000000u), 4) == 0x08000000u));
+  REQUIRE(tsimd::all(tsimd::sra(vuint(0x80000000u), 4) == 0xf8000000u));
+
+  vint r1 = tsimd::sra(v1, n);
+  vint r2 = v1;
+  r2 <<= n;
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(r1[i] == (int_type(-16) >> i));
+    REQUIRE(r2[i] == int_type(-16 * (int_type(1) << i)));
+  }
+}
+
+TEST_CASE("8/16-bit shift operators", "[bitwise_operators]")
+{
+  vschar c1(int8_t(-64));
+  vuchar u1(uint8_t(0xc3));
+  vshort s1(int16_t(-32768));
+  vushort w1(uint16_t(0x8001));
+
+  REQUIRE(tsimd::all((c1 >> 3) == vschar(int8_t(-8))));
+  REQUIRE(tsimd::all((c1 << 1) == vschar(int8_t(-128))));
+  REQUIRE(tsimd::all(tsimd::srl(c1, 3) == vschar(int8_t(24))));
+  REQUIRE(tsimd::all((u1 >> 2) == vuchar(uint8_t(0x30))));
+  REQUIRE(tsimd::all((u1 << 2) == vuchar(uint8_t(0x0c))));
+  REQUIRE(tsimd::all((s1 >> 15) == vshort(int16_t(-1))));
+  REQUIRE(tsimd::all((w1 >> vushort(uint16_t(15))) == vushort(uint16_t(1))));
+  REQUIRE(tsimd::all((w1 << 1) == vushort(uint16_t(2))));
+}
+
 // pack<> logic operators /////////////////////////////////////////////////////
 
 TEST_CASE("binary operator==()", "[logic_operators]")
@@ -307,6 +512,77 @@ TEST_CASE("binary operator>=()", "[logic_operators]")
   REQUIRE(tsimd::all(v1 >= 2));
 }
 
+TEST_CASE("NaN comparison operators", "[logic_operators]")
+{
+  vfloat nan(std::numeric_limits<float>::quiet_NaN());
+
+  REQUIRE(tsimd::none(nan == nan));
+  REQUIRE(tsimd::all(nan != nan));
+  REQUIRE(tsimd::none(nan < 1.f));
+  REQUIRE(tsimd::none(nan <= 1.f));
+  REQUIRE(tsimd::none(nan > 1.f));
+  REQUIRE(tsimd::none(nan >= 1.f));
+}
+
+TEST_CASE("unsigned comparison operators", "[logic_operators]")
+{
+  vuint v1(0x80000000u);
+  vuint v2(1u);
+
+  REQUIRE(tsimd::all(v1 > v2));
+  REQUIRE(tsimd::all(v1 >= v2));
+  REQUIRE(tsimd::all(v2 < v1));
+  REQUIRE(tsimd::all(v2 <= v1));
+  REQUIRE(tsimd::none(v1 < v2));
+  REQUIRE(tsimd::none(0xffffffffu <= v1));
+
+  v2[0] = 0x80000000u;
+
+  REQUIRE(tsimd::any(v1 == v2));
+  REQUIRE(!tsimd::all(v1 > v2));
+  REQUIRE(tsimd::all(v1 >= v2));
+}
+
+TEST_CASE("8/16-bit comparison operators", "[logic_operators]")
+{
+  vschar c1(int8_t(-1)), c2(int8_t(1));
+  vuchar u1(uint8_t(255)), u2(uint8_t(1));
+  vshort s1(int16_t(-1)), s2(int16_t(1));
+  vushort w1(uint16_t(65535)), w2(uint16_t(1));
+
+  REQUIRE(tsimd::all(c1 < c2));
+  REQUIRE(tsimd::all(u1 > u2));
+  REQUIRE(tsimd::all(s1 <= s2));
+  REQUIRE(tsimd::all(w1 >= w2));
+  REQUIRE(tsimd::none(u1 < u2));
+  REQUIRE(tsimd::none(w1 == w2));
+
+  REQUIRE(tsimd::all(tsimd::select(u1 > u2, c1, c2) == c1));
+  REQUIRE(tsimd::all(tsimd::select(w1 < w2, s1, s2) == s2));
+  REQUIRE(tsimd::all(tsimd::min(u1, u2) == u2));
+  REQUIRE(tsimd::all(tsimd::max(s1, s2) == s2));
+}
+
+TEST_CASE("composite width comparison operators", "[logic_operators]")
+{
+  tsimd::vdouble2 d1(-1.0), d2(1.0);
+  tsimd::vfloat32 f1(-1.f), f2(1.f);
+  tsimd::vllong2 l1(-1ll), l2(1ll);
+  tsimd::vuint64 u1(0xffffffffu), u2(1u);
+
+  f1[31] = 2.f;
+
+  REQUIRE(tsimd::all(d1 < d2));
+  REQUIRE(tsimd::all(l1 <= l2));
+  REQUIRE(tsimd::all(u1 > u2));
+  REQUIRE(tsimd::any(f1 >= f2));
+  REQUIRE(!tsimd::all(f1 < f2));
+
+  REQUIRE(tsimd::all(tsimd::select(f1 < f2, f2, f1) == tsimd::max(f1, f2)));
+  REQUIRE(tsimd::all(tsimd::select(l1 < l2, l1, l2) == tsimd::min(l1, l2)));
+  REQUIRE(tsimd::all(tsimd::abs(d1) == d2));
+}
+
 TEST_CASE("binary operator&&()", "[logic_operators]")
 {
   vbool m1(true);
@@ -330,6 +606,28 @@ TEST_CASE("unary operator!()", "[logic_operators]")
   REQUIRE(tsimd::all(!v == vbool(false)));
 }
 
+TEST_CASE("mask element access", "[logic_operators]")
+{
+  vbool m(false);
+  m[0] = true;
+
+  REQUIRE(m[0]);
+  REQUIRE(tsimd::any(m));
+  REQUIRE(!(!m)[0]);
+
+  for (int i = 1; i < vbool::static_size; ++i) {
+    REQUIRE(!m[i]);
+    REQUIRE((!m)[i]);
+  }
+
+  REQUIRE(tsimd::all(m | !m));
+  REQUIRE(tsimd::none(m & !m));
+  REQUIRE(tsimd::all(!!m == m));
+
+  m[0] = false;
+  REQUIRE(tsimd::none(m));
+}
+
 TEST_CASE("unary operator-()", "[logic_operators]")
 {
   vint v1(2);
@@ -381,6 +679,15 @@ TEST_CASE("max()", "[math_functions]")
   REQUIRE(tsimd::all(tsimd::max(v3, v4) == 2));
 }
 
+TEST_CASE("unsigned min()/max()", "[math_functions]")
+{
+  vuint v1(0x80000000u);
+  vuint v2(1u);
+
+  REQUIRE(tsimd::all(tsimd::min(v1, v2) == v2));
+  REQUIRE(tsimd::all(tsimd::max(v1, v2) == v1));
+}
+
 TEST_CASE("sqrt()", "[math_functions]")
 {
   vfloat v1(4.f);
@@ -427,6 +734,453 @@ TEST_CASE("pow()", "[math_functions]")
   REQUIRE(tsimd::all(tsimd::near_equal(tsimd::pow(v, 2.5f), pow(2.f, 2.5f))));
 }
 
+// Distance between a result and its reference in units in the last place of
+// the reference (NaN vs. NaN and exact matches count as 0)
+static double ulp_error(double value, double reference)
+{
+  if (value == reference || (std::isnan(value) && std::isnan(reference)))
+    return 0.0;
+  if (!std::isfinite(value) || !std::isfinite(reference))
+    return std::numeric_limits<double>::infinity();
+
+  int e;
+  std::frexp(reference, &e);
+  const double ulp = std::ldexp(1.0, std::max(e - 53, -1074));
+  return std::fabs(value - reference) / ulp;
+}
+
+// Max ulp error of FCN against REF for n evenly spaced inputs in [lo, hi]
+template <typename FCN_T, typename REF_T>
+static double max_ulp_error(double lo, double hi, int n, FCN_T fcn, REF_T ref)
+{
+  using vdouble = tsimd::pack<double, TEST_WIDTH>;
+
+  double worst = 0.0;
+
+  for (int i = 0; i < n; i += TEST_WIDTH) {
+    vdouble x;
+    for (int j = 0; j < TEST_WIDTH; ++j)
+      x[j] = lo + (hi - lo) * (i + j) / n;
+
+    const vdouble result = fcn(x);
+
+    for (int j = 0; j < TEST_WIDTH; ++j)
+      worst = std::max(worst, ulp_error(result[j], ref(x[j])));
+  }
+
+  return worst;
+}
+
+TEST_CASE("double precision exp()/log()", "[math_functions]")
+{
+  using vdouble = tsimd::pack<double, TEST_WIDTH>;
+
+  auto exp = [](const vdouble &x) { return tsimd::exp(x); };
+  auto log = [](const vdouble &x) { return tsimd::log(x); };
+  auto std_exp = [](double x) { return std::exp(x); };
+  auto std_log = [](double x) { return std::log(x); };
+
+  REQUIRE(max_ulp_error(-1.0, 1.0, 65536, exp, std_exp) <= 1.0);
+  REQUIRE(max_ulp_error(-745.0, 709.7, 65536, exp, std_exp) <= 1.0);
+  REQUIRE(max_ulp_error(0.5, 2.0, 65536, log, std_log) <= 1.0);
+  REQUIRE(max_ulp_error(1e-300, 1e300, 65536, log, std_log) <= 1.0);
+  REQUIRE(max_ulp_error(1e-320, 1e-300, 4096, log, std_log) <= 1.0);
+
+  const double inf = std::numeric_limits<double>::infinity();
+  vdouble special(inf);
+  REQUIRE(tsimd::all(tsimd::exp(special) == inf));
+  REQUIRE(tsimd::all(tsimd::exp(-special) == 0.0));
+  REQUIRE(tsimd::all(tsimd::log(special) == inf));
+  REQUIRE(tsimd::all(tsimd::log(vdouble(0.0)) == -inf));
+  REQUIRE(tsimd::none(tsimd::log(vdouble(-1.0)) == tsimd::log(vdouble(-1.0))));
+}
+
+TEST_CASE("double precision sin()/cos()/tan()", "[math_functions]")
+{
+  using vdouble = tsimd::pack<double, TEST_WIDTH>;
+
+  auto sin = [](const vdouble &x) { return tsimd::sin(x); };
+  auto cos = [](const vdouble &x) { return tsimd::cos(x); };
+  auto tan = [](const vdouble &x) { return tsimd::tan(x); };
+  auto std_sin = [](double x) { return std::sin(x); };
+  auto std_cos = [](double x) { return std::cos(x); };
+  auto std_tan = [](double x) { return std::tan(x); };
+
+  REQUIRE(max_ulp_error(-10.0, 10.0, 65536, sin, std_sin) <= 1.0);
+  REQUIRE(max_ulp_error(-10.0, 10.0, 65536, cos, std_cos) <= 1.0);
+  REQUIRE(max_ulp_error(-10.0, 10.0, 65536, tan, std_tan) <= 2.0);
+  REQUIRE(max_ulp_error(-1e6, 1e6, 65536, sin, std_sin) <= 2.0);
+  REQUIRE(max_ulp_error(-1e6, 1e6, 65536, cos, std_cos) <= 2.0);
+  REQUIRE(max_ulp_error(-1e9, 1e9, 4096, sin, std_sin) <= 2.0);
+  REQUIRE(max_ulp_error(-1e300, 1e300, 4096, sin, std_sin) <= 2.0);
+  REQUIRE(max_ulp_error(-1e300, 1e300, 4096, tan, std_tan) <= 3.0);
+}
+
+TEST_CASE("double precision sincos()", "[math_functions]")
+{
+  using vdouble = tsimd::pack<double, TEST_WIDTH>;
+
+  auto sin = [](const vdouble &x) {
+    vdouble s, c;
+    tsimd::sincos(x, s, c);
+    return s;
+  };
+  auto cos = [](const vdouble &x) {
+    vdouble s, c;
+    tsimd::sincos(x, s, c);
+    return c;
+  };
+  auto std_sin = [](double x) { return std::sin(x); };
+  auto std_cos = [](double x) { return std::cos(x); };
+
+  REQUIRE(max_ulp_error(-10.0, 10.0, 65536, sin, std_sin) <= 1.0);
+  REQUIRE(max_ulp_error(-10.0, 10.0, 65536, cos, std_cos) <= 1.0);
+  REQUIRE(max_ulp_error(-1e22, 1e22, 4096, sin, std_sin) <= 2.0);
+  REQUIRE(max_ulp_error(-1e22, 1e22, 4096, cos, std_cos) <= 2.0);
+}
+
+TEST_CASE("double precision pow()", "[math_functions]")
+{
+  using vdouble = tsimd::pack<double, TEST_WIDTH>;
+
+  auto pow_x = [](const vdouble &x) { return tsimd::pow(x, 2.5); };
+  auto pow_y = [](const vdouble &y) { return tsimd::pow(vdouble(1.7), y); };
+  auto cube  = [](const vdouble &x) { return tsimd::pow(x, vdouble(3.0)); };
+  auto std_pow_x = [](double x) { return std::pow(x, 2.5); };
+  auto std_pow_y = [](double y) { return std::pow(1.7, y); };
+  auto std_cube  = [](double x) { return std::pow(x, 3.0); };
+
+  REQUIRE(max_ulp_error(0.0, 1000.0, 65536, pow_x, std_pow_x) <= 2.0);
+  REQUIRE(max_ulp_error(-300.0, 300.0, 65536, pow_y, std_pow_y) <= 2.0);
+  REQUIRE(max_ulp_error(-10.0, 10.0, 65536, cube, std_cube) <= 2.0);
+
+  const double inf = std::numeric_limits<double>::infinity();
+  REQUIRE(tsimd::all(tsimd::pow(vdouble(-0.0), -3.0) == -inf));
+  REQUIRE(tsimd::all(tsimd::pow(vdouble(-inf), 0.5) == inf));
+  REQUIRE(tsimd::all(tsimd::pow(vdouble(0.5), -inf) == inf));
+  REQUIRE(tsimd::all(tsimd::pow(vdouble(-1.0), inf) == 1.0));
+  REQUIRE(tsimd::all(tsimd::pow(vdouble(-2.0), 0.5) != 1.0));
+}
+
+TEST_CASE("double precision atan()/atan2()/asin()/acos()", "[math_functions]")
+{
+  using vdouble = tsimd::pack<double, TEST_WIDTH>;
+
+  auto atan  = [](const vdouble &x) { return tsimd::atan(x); };
+  auto atan2 = [](const vdouble &y) { return tsimd::atan2(y, vdouble(-0.7)); };
+  auto asin  = [](const vdouble &x) { return tsimd::asin(x); };
+  auto acos  = [](const vdouble &x) { return tsimd::acos(x); };
+  auto std_atan  = [](double x) { return std::atan(x); };
+  auto std_atan2 = [](double y) { return std::atan2(y, -0.7); };
+  auto std_asin  = [](double x) { return std::asin(x); };
+  auto std_acos  = [](double x) { return std::acos(x); };
+
+  REQUIRE(max_ulp_error(-10.0, 10.0, 65536, atan, std_atan) <= 1.0);
+  REQUIRE(max_ulp_error(-1e10, 1e10, 4096, atan, std_atan) <= 1.0);
+  REQUIRE(max_ulp_error(-10.0, 10.0, 65536, atan2, std_atan2) <= 2.0);
+  REQUIRE(max_ulp_error(-1.0, 1.0, 65536, asin, std_asin) <= 1.0);
+  REQUIRE(max_ulp_error(-1.0, 1.0, 65536, acos, std_acos) <= 1.0);
+
+  const double inf = std::numeric_limits<double>::infinity();
+  const double pi  = 3.14159265358979323846;
+  REQUIRE(tsimd::all(tsimd::atan(vdouble(-inf)) == -pi / 2));
+  REQUIRE(tsimd::all(tsimd::atan2(vdouble(0.0), vdouble(-0.0)) == pi));
+  REQUIRE(tsimd::all(tsimd::atan2(vdouble(inf), vdouble(inf)) == pi / 4));
+  REQUIRE(tsimd::all(tsimd::acos(vdouble(-1.0)) == pi));
+  REQUIRE(tsimd::none(tsimd::acos(vdouble(2.0)) == tsimd::acos(vdouble(2.0))));
+}
+
+TEST_CASE("double precision sinh()/cosh()/tanh()", "[math_functions]")
+{
+  using vdouble = tsimd::pack<double, TEST_WIDTH>;
+
+  auto sinh = [](const vdouble &x) { return tsimd::sinh(x); };
+  auto cosh = [](const vdouble &x) { return tsimd::cosh(x); };
+  auto tanh = [](const vdouble &x) { return tsimd::tanh(x); };
+  auto std_sinh = [](double x) { return std::sinh(x); };
+  auto std_cosh = [](double x) { return std::cosh(x); };
+  auto std_tanh = [](double x) { return std::tanh(x); };
+
+  REQUIRE(max_ulp_error(-1.0, 1.0, 65536, sinh, std_sinh) <= 2.0);
+  REQUIRE(max_ulp_error(-710.0, 710.0, 65536, sinh, std_sinh) <= 2.0);
+  REQUIRE(max_ulp_error(-710.0, 710.0, 65536, cosh, std_cosh) <= 2.0);
+  REQUIRE(max_ulp_error(-20.0, 20.0, 65536, tanh, std_tanh) <= 2.0);
+
+  const double inf = std::numeric_limits<double>::infinity();
+  REQUIRE(tsimd::all(tsimd::sinh(vdouble(-inf)) == -inf));
+  REQUIRE(tsimd::all(tsimd::cosh(vdouble(711.0)) == inf));
+  REQUIRE(tsimd::all(tsimd::tanh(vdouble(-inf)) == -1.0));
+}
+
+// Same as ulp_error(), in ulps of the float nearest to the reference
+static double float_ulp_error(float value, double reference)
+{
+  if (value == float(reference) || (std::isnan(value) && std::isnan(reference)))
+    return 0.0;
+  if (!std::isfinite(value) || !std::isfinite(reference))
+    return std::numeric_limits<double>::infinity();
+
+  int e;
+  std::frexp(reference, &e);
+  const double ulp = std::ldexp(1.0, std::max(e - 24, -149));
+  return std::fabs(value - reference) / ulp;
+}
+
+// Checks each result against its double precision reference
+struct tier_check
+{
+  vsingle result;
+  double (*reference)(double);
+  bool abs_input;
+  double bound;
+};
+
+template <int N>
+static void check_tier(const vsingle &x, const tier_check (&checks)[N])
+{
+  for (const tier_check &c : checks) {
+    for (int i = 0; i < TEST_WIDTH; ++i) {
+      const double in = c.abs_input ? std::abs(x[i]) + 0.1f : x[i];
+      REQUIRE(float_ulp_error(c.result[i], c.reference(in)) <= c.bound);
+    }
+  }
+}
+
+static double std_exp(double x)
+{
+  return std::exp(x);
+}
+
+static double std_log(double x)
+{
+  return std::log(x);
+}
+
+static double std_sin(double x)
+{
+  return std::sin(x);
+}
+
+static double std_cos(double x)
+{
+  return std::cos(x);
+}
+
+static double std_tan(double x)
+{
+  return std::tan(x);
+}
+
+static double std_pow(double x)
+{
+  return std::pow(x, double(2.4f));
+}
+
+static double std_sqrt(double x)
+{
+  return std::sqrt(x);
+}
+
+static double std_rcp(double x)
+{
+  return 1.0 / x;
+}
+
+static vsingle tier_input()
+{
+  vsingle x;
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    x[i] = -3.3f + 1.7f * i;
+  return x;
+}
+
+TEST_CASE("fast:: tier", "[math_functions]")
+{
+  const vsingle x  = tier_input();
+  const vsingle ax = tsimd::abs(x) + 0.1f;
+
+  const tier_check checks[] = {{tsimd::fast::exp(x), std_exp, false, 1.5},
+                               {tsimd::fast::log(ax), std_log, true, 1.0},
+                               {tsimd::fast::sin(x), std_sin, false, 2.5},
+                               {tsimd::fast::cos(x), std_cos, false, 2.5},
+                               {tsimd::fast::tan(x), std_tan, false, 4.0},
+                               {tsimd::fast::pow(ax, 2.4f), std_pow, true, 8.0},
+                               {tsimd::fast::sqrt(ax), std_sqrt, true, 3.0},
+                               {tsimd::fast::rcp(x), std_rcp, false, 3.0}};
+  check_tier(x, checks);
+
+  REQUIRE(tsimd::all(tsimd::fast::sqrt(vsingle(0.f)) == 0.f));
+}
+
+TEST_CASE("default tier", "[math_functions]")
+{
+  const vsingle x  = tier_input();
+  const vsingle ax = tsimd::abs(x) + 0.1f;
+
+  const tier_check checks[] = {{tsimd::exp(x), std_exp, false, 1.5},
+                               {tsimd::log(ax), std_log, true, 1.0},
+                               {tsimd::sin(x), std_sin, false, 2.5},
+                               {tsimd::cos(x), std_cos, false, 2.5},
+                               {tsimd::tan(x), std_tan, false, 4.0},
+                               {tsimd::pow(ax, 2.4f), std_pow, true, 1.0},
+                               {tsimd::rcp(x), std_rcp, false, 0.5}};
+  check_tier(x, checks);
+
+  const float inf = std::numeric_limits<float>::infinity();
+  REQUIRE(tsimd::all(tsimd::exp(vsingle(-inf)) == 0.f));
+  REQUIRE(tsimd::all(tsimd::exp(vsingle(100.f)) == inf));
+  REQUIRE(tsimd::all(tsimd::exp(vsingle(-100.f)) > 0.f));
+  REQUIRE(tsimd::all(tsimd::log(vsingle(0.f)) == -inf));
+  REQUIRE(tsimd::none(tsimd::sin(vsingle(inf)) == tsimd::sin(vsingle(inf))));
+
+  const double big = 1e30f;
+  REQUIRE(float_ulp_error(tsimd::sin(vsingle(big))[0], std::sin(big)) <= 2.5);
+}
+
+TEST_CASE("precise:: tier", "[math_functions]")
+{
+  const vsingle x = tier_input();
+
+  const tier_check checks[] = {{tsimd::precise::exp(x), std_exp, false, 1.0},
+                               {tsimd::precise::sin(x), std_sin, false, 1.0}};
+  check_tier(x, checks);
+}
+
+static double std_rsqrt(double x)
+{
+  return 1.0 / std::sqrt(x);
+}
+
+static double std_div(double x)
+{
+  return 1.75 / x;
+}
+
+TEST_CASE("rcp<N>()/rsqrt<N>()/fast_div()", "[math_functions]")
+{
+  const vsingle x  = tier_input();
+  const vsingle ax = tsimd::abs(x) + 0.1f;
+  const vsingle a  = vsingle(1.75f);
+
+  // the estimates have a relative error of 1.5 * 2^-12, which is 6144 ulp
+  const tier_check checks[] = {
+      {tsimd::rcp<0>(x), std_rcp, false, 6144.0},
+      {tsimd::rcp<1>(x), std_rcp, false, 3.0},
+      {tsimd::rcp<2>(x), std_rcp, false, 1.5},
+      {tsimd::rsqrt<0>(ax), std_rsqrt, true, 6144.0},
+      {tsimd::rsqrt<1>(ax), std_rsqrt, true, 3.5},
+      {tsimd::rsqrt<2>(ax), std_rsqrt, true, 1.5},
+      {tsimd::fast_div<0>(a, x), std_div, false, 6144.5},
+      {tsimd::fast_div(a, x), std_div, false, 3.5},
+      {tsimd::fast_div<2>(a, x), std_div, false, 2.0}};
+  check_tier(x, checks);
+
+  const float inf = std::numeric_limits<float>::infinity();
+  REQUIRE(tsimd::all(tsimd::rcp<0>(vsingle(0.f)) == inf));
+  REQUIRE(tsimd::all(tsimd::rsqrt<0>(vsingle(inf)) == 0.f));
+}
+
+TEST_CASE("sincos()", "[math_functions]")
+{
+  vsingle x = tier_input();
+  x[0]      = 1e30f;
+
+  vsingle s, c, fs, fc;
+  tsimd::sincos(x, s, c);
+  tsimd::fast::sincos(tier_input(), fs, fc);
+
+  const tier_check checks[] = {{fs, std_sin, false, 2.5},
+                               {fc, std_cos, false, 2.5}};
+  check_tier(tier_input(), checks);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(float_ulp_error(s[i], std::sin(double(x[i]))) <= 2.5);
+    REQUIRE(float_ulp_error(c[i], std::cos(double(x[i]))) <= 2.5);
+  }
+}
+
+static double std_atan(double x)
+{
+  return std::atan(x);
+}
+
+static double std_atan2(double y)
+{
+  return std::atan2(y, double(-1.5f));
+}
+
+static double std_asin(double x)
+{
+  return std::asin(x);
+}
+
+static double std_acos(double x)
+{
+  return std::acos(x);
+}
+
+static double std_sinh(double x)
+{
+  return std::sinh(x);
+}
+
+static double std_cosh(double x)
+{
+  return std::cosh(x);
+}
+
+static double std_tanh(double x)
+{
+  return std::tanh(x);
+}
+
+TEST_CASE("atan()/atan2()/asin()/acos()", "[math_functions]")
+{
+  const vsingle x = tier_input();
+
+  vsingle u;
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    u[i] = -0.9375f + 0.125f * i;
+
+  const tier_check checks[] = {
+      {tsimd::atan(x), std_atan, false, 2.5},
+      {tsimd::atan2(x, vsingle(-1.5f)), std_atan2, false, 3.0}};
+  check_tier(x, checks);
+
+  const tier_check unit_checks[] = {{tsimd::asin(u), std_asin, false, 2.5},
+                                    {tsimd::acos(u), std_acos, false, 2.0}};
+  check_tier(u, unit_checks);
+
+  const float inf  = std::numeric_limits<float>::infinity();
+  const float pi   = 3.14159265358979323846;
+  const vsingle z  = vsingle(0.f);
+  const vsingle nz = vsingle(-0.f);
+  REQUIRE(tsimd::all(tsimd::atan(vsingle(inf)) == float(pi / 2)));
+  REQUIRE(tsimd::all(tsimd::atan2(z, nz) == pi));
+  REQUIRE(std::signbit(tsimd::atan2(nz, z)[0]));
+  REQUIRE(tsimd::all(tsimd::atan2(vsingle(-inf), vsingle(-inf)) ==
+                     float(-0.75 * 3.14159265358979323846)));
+  REQUIRE(tsimd::all(tsimd::acos(vsingle(1.f)) == 0.f));
+  REQUIRE(tsimd::none(tsimd::asin(vsingle(2.f)) == tsimd::asin(vsingle(2.f))));
+}
+
+TEST_CASE("sinh()/cosh()/tanh()", "[math_functions]")
+{
+  const vsingle x = tier_input();
+
+  const tier_check checks[] = {{tsimd::sinh(x), std_sinh, false, 2.0},
+                               {tsimd::cosh(x), std_cosh, false, 2.0},
+                               {tsimd::tanh(x), std_tanh, false, 2.0}};
+  check_tier(x, checks);
+
+  const float inf = std::numeric_limits<float>::infinity();
+  REQUIRE(tsimd::all(tsimd::sinh(vsingle(-inf)) == -inf));
+  REQUIRE(tsimd::all(tsimd::cosh(vsingle(-100.f)) == inf));
+  REQUIRE(tsimd::all(tsimd::tanh(vsingle(inf)) == 1.f));
+  REQUIRE(tsimd::all(tsimd::tanh(vsingle(-inf)) == -1.f));
+  REQUIRE(std::signbit(tsimd::sinh(vsingle(-0.f))[0]));
+}
+
 // pack<> algorithms //////////////////////////////////////////////////////////
 
 TEST_CASE("foreach()", "[algorithms]")
@@ -616,6 +1370,156 @@ TEST_CASE("unmasked scatter()", "[memory_operations]")
       values.begin(), values.end(), [](int_type v) { REQUIRE(v == 5); });
 }
 
+TEST_CASE("composite width load()/store()", "[memory_operations]")
+{
+  TSIMD_ALIGN(64) std::array<float, 32> values;
+  std::iota(values.begin(), values.end(), 0.f);
+
+  auto v1 = tsimd::load<tsimd::vfloat32>(values.data());
+  tsimd::store(v1 * 2.f, values.data());
+  tsimd::store(tsimd::vfloat32(0.f), values.data(), v1 < 10.f);
+
+  for (int i = 0; i < 32; ++i)
+    REQUIRE(values[i] == (i < 10 ? 0.f : 2.f * i));
+
+  TSIMD_ALIGN(16) std::array<double, 2> doubles = {{1.0, 2.0}};
+
+  tsimd::vboold2 m(true);
+  m[1] = false;
+
+  auto v2 = tsimd::load<tsimd::vdouble2>(doubles.data(), m);
+  REQUIRE(v2[0] == 1.0);
+  REQUIRE(v2[1] == 0.0);
+}
+
+TEST_CASE("load_half()/store_half()", "[memory_operations]")
+{
+  std::array<tsimd::half_t, vsingle::static_size> values;
+  std::fill(values.begin(), values.end(), tsimd::half_t(-2.25f));
+  values[0] = tsimd::half_t(65504.f);
+
+  auto v1 = tsimd::load_half<vsingle>(values.data());
+
+  vsingle expected(-2.25f);
+  expected[0] = 65504.f;
+  REQUIRE(tsimd::all(v1 == expected));
+
+  vsingle v2(1.5f);
+  tsimd::store_half(v2, values.data());
+
+  std::for_each(values.begin(), values.end(), [](tsimd::half_t v) {
+    REQUIRE(static_cast<float>(v) == 1.5f);
+  });
+}
+
+TEST_CASE("store_half() rounding", "[memory_operations]")
+{
+  std::array<tsimd::half_t, vsingle::static_size> values;
+
+  // exactly halfway between 1.0 and the next half (1 + 2^-10)
+  vsingle v1(1.f + 0.00048828125f);
+
+  tsimd::store_half(v1, values.data());
+  REQUIRE(values[0].bits == 0x3c00);
+
+  tsimd::store_half<tsimd::half_rounding::up>(v1, values.data());
+  REQUIRE(values[0].bits == 0x3c01);
+
+  tsimd::store_half<tsimd::half_rounding::down>(-v1, values.data());
+  REQUIRE(values[0].bits == 0xbc01);
+
+  tsimd::store_half<tsimd::half_rounding::toward_zero>(-v1, values.data());
+  REQUIRE(values[0].bits == 0xbc00);
+
+  tsimd::store_half(vsingle(1e6f), values.data());
+  REQUIRE(values[0].bits == 0x7c00);
+}
+
+TEST_CASE("masked load_half()/store_half()", "[memory_operations]")
+{
+  std::array<tsimd::half_t, vsingle::static_size> values;
+  std::fill(values.begin(), values.end(), tsimd::half_t(5.f));
+
+  tsimd::vboolfn<vsingle::static_size> m(true);
+  m[0] = false;
+
+  auto v1 = tsimd::load_half<vsingle>(values.data(), m);
+
+  vsingle expected(5.f);
+  expected[0] = 0.f;
+  REQUIRE(tsimd::all(v1 == expected));
+
+  tsimd::store_half(vsingle(3.f), values.data(), m);
+
+  REQUIRE(static_cast<float>(values[0]) == 5.f);
+  std::for_each(values.begin() + 1, values.end(), [](tsimd::half_t v) {
+    REQUIRE(static_cast<float>(v) == 3.f);
+  });
+}
+
+TEST_CASE("gather_half()", "[memory_operations]")
+{
+  std::array<tsimd::half_t, vsingle::static_size> values;
+  for (int i = 0; i < vsingle::static_size; ++i)
+    values[i] = tsimd::half_t(float(i));
+
+  tsimd::vintn<vsingle::static_size> offset;
+  std::iota(offset.begin(), offset.end(), 0);
+  std::reverse(offset.begin(), offset.end());
+
+  auto result = tsimd::gather_half<vsingle>(values.data(), offset);
+
+  vsingle expected;
+  for (int i = 0; i < vsingle::static_size; ++i)
+    expected[i] = float(vsingle::static_size - 1 - i);
+
+  REQUIRE(tsimd::all(result == expected));
+}
+
+TEST_CASE("load_bf16()/store_bf16()", "[memory_operations]")
+{
+  std::array<tsimd::bf16_t, vsingle::static_size> values;
+
+  vsingle v1;
+  for (int i = 0; i < vsingle::static_size; ++i)
+    v1[i] = 1.f / (i + 3);
+
+  tsimd::store_bf16(v1, values.data());
+
+  for (int i = 0; i < vsingle::static_size; ++i)
+    REQUIRE(values[i].bits == tsimd::bf16_t(v1[i]).bits);
+
+  auto v2 = tsimd::load_bf16<vsingle>(values.data());
+
+  for (int i = 0; i < vsingle::static_size; ++i)
+    REQUIRE(v2[i] == static_cast<float>(values[i]));
+
+  // ties round to even: 1 + 2^-8 --> 1, 1 + 3 * 2^-8 --> 1 + 2^-6
+  tsimd::store_bf16(vsingle(1.00390625f), values.data());
+  REQUIRE(values[0].bits == 0x3f80);
+
+  tsimd::store_bf16(vsingle(1.01171875f), values.data());
+  REQUIRE(values[0].bits == 0x3f82);
+}
+
+TEST_CASE("dot_bf16()", "[math_functions]")
+{
+  std::array<tsimd::bf16_t, 2 * vsingle::static_size> a, b;
+
+  for (int i = 0; i < 2 * vsingle::static_size; ++i) {
+    a[i] = tsimd::bf16_t(0.5f * (i + 1));
+    b[i] = tsimd::bf16_t(i % 2 ? -2.f : 3.f);
+  }
+
+  auto result = tsimd::dot_bf16(vsingle(1.f), a.data(), b.data());
+
+  for (int i = 0; i < vsingle::static_size; ++i) {
+    float expected = 1.f + float(a[2 * i + 1]) * float(b[2 * i + 1]) +
+                     float(a[2 * i]) * float(b[2 * i]);
+    REQUIRE(result[i] == expected);
+  }
+}
+
 // random numbers /////////////////////////////////////////////////////////////
 
 TEST_CASE("uniform_random_distribution()", "[random]]")
@@ -0,0 +1,94 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+#include "config.h"
+
+namespace tsimd {
+
+  // Scalar bfloat16 <--> binary32 conversions ////////////////////////////////
+
+  namespace detail {
+
+    TSIMD_INLINE float bf16_to_float(uint16_t h)
+    {
+      const uint32_t bits = uint32_t(h) << 16;
+      float f;
+      std::memcpy(&f, &bits, sizeof(f));
+      return f;
+    }
+
+    // NOTE: round-to-nearest-even, NaNs are truncated and made quiet
+    TSIMD_INLINE uint16_t float_to_bf16(float f)
+    {
+      uint32_t x;
+      std::memcpy(&x, &f, sizeof(x));
+
+      if ((x & 0x7fffffff) > 0x7f800000)
+        return (x >> 16) | 0x40;
+
+      return (x + 0x7fff + ((x >> 16) & 1)) >> 16;
+    }
+
+  }  // namespace detail
+
+  // 16-bit bfloat16 storage type /////////////////////////////////////////////
+
+  // NOTE: this is a storage-only type, load it into a vfloat to do math on it
+  struct bf16_t
+  {
+    bf16_t()               = default;
+    bf16_t(const bf16_t &) = default;
+    bf16_t(bf16_t &&)      = default;
+    bf16_t &operator=(const bf16_t &) = default;
+    bf16_t &operator=(bf16_t &&) = default;
+
+    TSIMD_INLINE explicit bf16_t(float f) noexcept
+        : bits(detail::float_to_bf16(f))
+    {
+    }
+
+    TSIMD_INLINE explicit operator float() const noexcept
+    {
+      return detail::bf16_to_float(bits);
+    }
+
+    uint16_t bits;
+  };
+
+  static_assert(sizeof(bf16_t) == 2, "bf16_t must be 16 bits wide!");
+
+  TSIMD_INLINE std::ostream &operator<<(std::ostream &o, const bf16_t &v)
+  {
+    o << static_cast<float>(v);
+    return o;
+  }
+
+}  // namespace tsimd
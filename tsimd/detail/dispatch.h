@@ -0,0 +1,275 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <utility>
+
+#include "config.h"
+
+#if TSIMD_WIN
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+// NOTE: a kernel is written once as a template over W, then compiled in one
+//       translation unit per ISA (see tsimd_dispatch_sources() in
+//       cmake/tsimd.cmake), each of which exports it with:
+//
+//         TSIMD_DISPATCH_TARGET(saxpy, saxpy_kernel<TSIMD_DEFAULT_WIDTH>,
+//                               void(float, const float *, float *, int))
+//
+//       Kernels must have internal linkage (static or in an anonymous
+//       namespace), otherwise the linker merges the per-ISA instantiations.
+//       A single (baseline ISA) translation unit then defines the callable:
+//
+//         TSIMD_DISPATCH(saxpy, void(float, const float *, float *, int))
+//
+//       which picks the best variant for the running CPU on first call.
+
+#if !defined(TSIMD_DISPATCH_ISA)
+#if defined(__AVX512VL__) && defined(__AVX512BW__) && defined(__AVX512DQ__)
+#define TSIMD_DISPATCH_ISA avx512skx
+#elif defined(__AVX512F__)
+#define TSIMD_DISPATCH_ISA avx512knl
+#elif defined(__AVX2__)
+#define TSIMD_DISPATCH_ISA avx2
+#elif defined(__AVX__)
+#define TSIMD_DISPATCH_ISA avx
+#else
+#define TSIMD_DISPATCH_ISA sse42
+#endif
+#endif
+
+#define TSIMD_DISPATCH_SYMBOL_(NAME, ISA) tsimd_dispatch_##NAME##_##ISA
+#define TSIMD_DISPATCH_SYMBOL(NAME, ISA) TSIMD_DISPATCH_SYMBOL_(NAME, ISA)
+
+#define TSIMD_DISPATCH_TARGET(NAME, FCN, ...)                       \
+  tsimd::detail::dispatch_fcn_t<__VA_ARGS__> TSIMD_DISPATCH_SYMBOL( \
+      NAME, TSIMD_DISPATCH_ISA)()                                   \
+  {                                                                 \
+    return &FCN;                                                    \
+  }
+
+#define TSIMD_DISPATCH(NAME, ...)                                           \
+  tsimd::detail::dispatch_fcn_t<__VA_ARGS__> tsimd_dispatch_##NAME##_sse42(); \
+  tsimd::detail::dispatch_fcn_t<__VA_ARGS__> tsimd_dispatch_##NAME##_avx();   \
+  tsimd::detail::dispatch_fcn_t<__VA_ARGS__> tsimd_dispatch_##NAME##_avx2();  \
+  tsimd::detail::dispatch_fcn_t<__VA_ARGS__>                                  \
+      tsimd_dispatch_##NAME##_avx512knl();                                    \
+  tsimd::detail::dispatch_fcn_t<__VA_ARGS__>                                  \
+      tsimd_dispatch_##NAME##_avx512skx();                                    \
+  tsimd::dispatched_function<__VA_ARGS__> NAME(                              \
+      &tsimd_dispatch_##NAME##_sse42,                                         \
+      &tsimd_dispatch_##NAME##_avx,                                           \
+      &tsimd_dispatch_##NAME##_avx2,                                          \
+      &tsimd_dispatch_##NAME##_avx512knl,                                     \
+      &tsimd_dispatch_##NAME##_avx512skx)
+
+namespace tsimd {
+
+  // ISAs a kernel can be dispatched to, in order of preference //////////////
+
+  // NOTE: each matches a TSIMD_BUILD_ISA flag set in cmake/
+  enum class isa
+  {
+    sse42     = 0,
+    avx       = 1,
+    avx2      = 2,
+    avx512knl = 3,
+    avx512skx = 4
+  };
+
+  static const int num_isas = 5;
+
+  inline const char *isa_name(isa i)
+  {
+    switch (i) {
+    case isa::sse42:
+      return "SSE4.2";
+    case isa::avx:
+      return "AVX";
+    case isa::avx2:
+      return "AVX2";
+    case isa::avx512knl:
+      return "AVX512KNL";
+    case isa::avx512skx:
+      return "AVX512SKX";
+    }
+    return "unknown";
+  }
+
+  // CPUID based ISA detection ////////////////////////////////////////////////
+
+  namespace detail {
+
+    template <typename FCN_T>
+    using dispatch_fcn_t = FCN_T *;
+
+    inline void cpuid(int leaf, int subleaf, unsigned int regs[4])
+    {
+#if TSIMD_WIN
+      __cpuidex((int *)regs, leaf, subleaf);
+#else
+      __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+    }
+
+    // NOTE: the OS must also save the wider registers on context switch
+    inline unsigned long long xgetbv()
+    {
+#if TSIMD_WIN
+      return _xgetbv(0);
+#else
+      unsigned int eax, edx;
+      __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+      return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+    }
+
+    inline bool has_bits(unsigned int reg, unsigned int bits)
+    {
+      return (reg & bits) == bits;
+    }
+
+    inline isa detect_isa()
+    {
+      unsigned int regs[4] = {0, 0, 0, 0};
+
+      cpuid(0, 0, regs);
+      const unsigned int max_leaf = regs[0];
+
+      cpuid(1, 0, regs);
+      const unsigned int ecx1 = regs[2];
+
+      unsigned int ebx7 = 0;
+      if (max_leaf >= 7) {
+        cpuid(7, 0, regs);
+        ebx7 = regs[1];
+      }
+
+      cpuid(0x80000000, 0, regs);
+      unsigned int ecx_ext = 0;
+      if (regs[0] >= 0x80000001) {
+        cpuid(0x80000001, 0, regs);
+        ecx_ext = regs[2];
+      }
+
+      // CPUID.1:ECX --> SSE4.2, FMA, OSXSAVE, AVX, F16C
+      const bool sse42   = has_bits(ecx1, 1u << 20);
+      const bool osxsave = has_bits(ecx1, 1u << 27);
+      const bool avx_hw  = has_bits(ecx1, 1u << 28);
+
+      const unsigned long long xcr0 = osxsave ? xgetbv() : 0;
+
+      // XCR0 --> SSE/AVX state (0x6) and opmask/ZMM state (0xe0)
+      const bool avx       = avx_hw && (xcr0 & 0x6) == 0x6;
+      const bool avx512_os = (xcr0 & 0xe6) == 0xe6;
+
+      // CPUID.7:EBX --> BMI1, AVX2, BMI2 + CPUID.1:ECX FMA/F16C, LZCNT
+      const bool avx2 = avx &&
+                        has_bits(ebx7, (1u << 3) | (1u << 5) | (1u << 8)) &&
+                        has_bits(ecx1, (1u << 12) | (1u << 29)) &&
+                        has_bits(ecx_ext, 1u << 5);
+
+      // CPUID.7:EBX --> AVX512F, CD + ER, PF (KNL) or DQ, BW, VL (SKX)
+      const unsigned int avx512f = (1u << 16) | (1u << 28);
+      const bool avx512knl = avx2 && avx512_os &&
+                             has_bits(ebx7, avx512f | (1u << 26) | (1u << 27));
+      const bool avx512skx =
+          avx2 && avx512_os &&
+          has_bits(ebx7, avx512f | (1u << 17) | (1u << 30) | (1u << 31));
+
+      if (avx512skx)
+        return isa::avx512skx;
+      else if (avx512knl)
+        return isa::avx512knl;
+      else if (avx2)
+        return isa::avx2;
+      else if (avx)
+        return isa::avx;
+      else if (sse42)
+        return isa::sse42;
+      else
+        throw std::runtime_error("tsimd dispatch requires at least SSE4.2!");
+    }
+
+  }  // namespace detail
+
+  // NOTE: the CPU doesn't change under us, so only ask CPUID once
+  inline isa cpu_isa()
+  {
+    static const isa detected = detail::detect_isa();
+    return detected;
+  }
+
+  // A function with one implementation per ISA, picked on first call ////////
+
+  template <typename FCN_T>
+  struct dispatched_function;
+
+  template <typename R, typename... ARGS>
+  struct dispatched_function<R(ARGS...)>
+  {
+    using fcn_t    = R (*)(ARGS...);
+    using target_t = fcn_t (*)();
+
+    // NOTE: constexpr so a global instance is initialized before any
+    //       static constructor can call it
+    constexpr dispatched_function(target_t sse42,
+                                  target_t avx,
+                                  target_t avx2,
+                                  target_t avx512knl,
+                                  target_t avx512skx)
+        : targets{{sse42, avx, avx2, avx512knl, avx512skx}}, fcn(nullptr)
+    {
+    }
+
+    R operator()(ARGS... args) const
+    {
+      return get()(std::forward<ARGS>(args)...);
+    }
+
+    // NOTE: racing first calls resolve to the same pointer, so a relaxed
+    //       store is enough
+    fcn_t get() const
+    {
+      fcn_t f = fcn.load(std::memory_order_relaxed);
+      if (!f) {
+        f = targets[static_cast<int>(cpu_isa())]();
+        fcn.store(f, std::memory_order_relaxed);
+      }
+      return f;
+    }
+
+   private:
+    std::array<target_t, num_isas> targets;
+    mutable std::atomic<fcn_t> fcn;
+  };
+
+}  // namespace tsimd
@@ -0,0 +1,219 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "functions/math/mulhi.h"
+#include "operators/arithmetic/minus.h"
+#include "operators/arithmetic/plus.h"
+#include "operators/arithmetic/times.h"
+#include "operators/bitwise/and.h"
+#include "operators/bitwise/right_shift.h"
+#include "pack.h"
+
+namespace tsimd {
+
+  // Division by a run-time invariant divisor /////////////////////////////////
+
+  // NOTE: the divisor is turned into a magic multiplier and shift once
+  //       (Granlund/Montgomery, as in libdivide and Hacker's Delight 10-1),
+  //       so dividing a pack<> is a mulhi() plus adds and shifts
+
+  template <typename T, int W = TSIMD_DEFAULT_WIDTH>
+  struct divider;
+
+  template <int W>
+  struct divider<unsigned int, W>
+  {
+    explicit divider(unsigned int d);
+
+    unsigned int divisor() const;
+
+    pack<unsigned int, W> divide(const pack<unsigned int, W> &n) const;
+
+   private:
+    unsigned int d;
+    pack<unsigned int, W> magic;
+    int shift1;
+    int shift2;
+  };
+
+  template <int W>
+  struct divider<int, W>
+  {
+    explicit divider(int d);
+
+    int divisor() const;
+
+    pack<int, W> divide(const pack<int, W> &n) const;
+
+   private:
+    int d;
+    pack<int, W> magic;
+    pack<int, W> add;    // all bits set when n must be added to mulhi()
+    pack<int, W> sub;    // all bits set when n must be subtracted instead
+    pack<int, W> round;  // all bits set unless |d| == 1
+    int shift;
+  };
+
+  // divider<unsigned int, W> //
+
+  template <int W>
+  inline divider<unsigned int, W>::divider(unsigned int _d) : d(_d)
+  {
+    if (d == 0)
+      throw std::runtime_error("tsimd::divider<> can't divide by zero!");
+
+    // l = ceil(log2(d))
+    int l = 0;
+    while ((uint64_t(1) << l) < d)
+      ++l;
+
+    const uint64_t m = (uint64_t(1) << 32) * ((uint64_t(1) << l) - d) / d;
+
+    magic  = pack<unsigned int, W>((unsigned int)(m + 1));
+    shift1 = l > 0 ? 1 : 0;
+    shift2 = l > 0 ? l - 1 : 0;
+  }
+
+  template <int W>
+  TSIMD_INLINE unsigned int divider<unsigned int, W>::divisor() const
+  {
+    return d;
+  }
+
+  template <int W>
+  TSIMD_INLINE pack<unsigned int, W> divider<unsigned int, W>::divide(
+      const pack<unsigned int, W> &n) const
+  {
+    const pack<unsigned int, W> q = mulhi(n, magic);
+    return (((n - q) >> shift1) + q) >> shift2;
+  }
+
+  // divider<int, W> //
+
+  template <int W>
+  inline divider<int, W>::divider(int _d) : d(_d)
+  {
+    if (d == 0)
+      throw std::runtime_error("tsimd::divider<> can't divide by zero!");
+
+    if (d == 1 || d == -1) {
+      magic = pack<int, W>(0);
+      add   = pack<int, W>(d == 1 ? -1 : 0);
+      sub   = pack<int, W>(d == 1 ? 0 : -1);
+      round = pack<int, W>(0);
+      shift = 0;
+      return;
+    }
+
+    const uint32_t two31 = 0x80000000u;
+    const uint32_t ad    = d < 0 ? 0u - uint32_t(d) : uint32_t(d);
+    const uint32_t t     = two31 + (uint32_t(d) >> 31);
+    const uint32_t anc   = t - 1 - t % ad;
+
+    int p       = 31;
+    uint32_t q1 = two31 / anc;
+    uint32_t r1 = two31 - q1 * anc;
+    uint32_t q2 = two31 / ad;
+    uint32_t r2 = two31 - q2 * ad;
+    uint32_t delta;
+
+    do {
+      ++p;
+      q1 *= 2;
+      r1 *= 2;
+      if (r1 >= anc) {
+        ++q1;
+        r1 -= anc;
+      }
+      q2 *= 2;
+      r2 *= 2;
+      if (r2 >= ad) {
+        ++q2;
+        r2 -= ad;
+      }
+      delta = ad - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+
+    int m = int(q2 + 1);
+    if (d < 0)
+      m = -m;
+
+    magic = pack<int, W>(m);
+    add   = pack<int, W>(d > 0 && m < 0 ? -1 : 0);
+    sub   = pack<int, W>(d < 0 && m > 0 ? -1 : 0);
+    round = pack<int, W>(-1);
+    shift = p - 32;
+  }
+
+  template <int W>
+  TSIMD_INLINE int divider<int, W>::divisor() const
+  {
+    return d;
+  }
+
+  template <int W>
+  TSIMD_INLINE pack<int, W> divider<int, W>::divide(
+      const pack<int, W> &n) const
+  {
+    pack<int, W> q = mulhi(n, magic) + (n & add) - (n & sub);
+    q              = q >> shift;
+    // round toward zero: add 1 to negative quotients
+    return q - ((q >> 31) & round);
+  }
+
+  // Operators ////////////////////////////////////////////////////////////////
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> operator/(const pack<T, W> &n,
+                                    const divider<T, W> &d)
+  {
+    return d.divide(n);
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> operator%(const pack<T, W> &n,
+                                    const divider<T, W> &d)
+  {
+    return n - d.divide(n) * pack<T, W>(d.divisor());
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> &operator/=(pack<T, W> &n, const divider<T, W> &d)
+  {
+    return n = d.divide(n);
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> &operator%=(pack<T, W> &n, const divider<T, W> &d)
+  {
+    return n = n % d;
+  }
+
+}  // namespace tsimd
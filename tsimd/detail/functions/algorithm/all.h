@@ -42,11 +42,36 @@ namespace tsimd {
     return any(a);
   }
 
+  TSIMD_INLINE bool all(const vboolb1 &a)
+  {
+    return any(a);
+  }
+
+  TSIMD_INLINE bool all(const vboolw1 &a)
+  {
+    return any(a);
+  }
+
+  // 2-wide //
+
+  TSIMD_INLINE bool all(const vboold2 &a)
+  {
+#if defined(__AVX512VL__)
+    return a.v == 0x3;
+#elif defined(__SSE__)
+    return _mm_movemask_pd(a) == 0x3;
+#else
+    return a[0] && a[1];
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE bool all(const vboolf4 &a)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return a.v == 0xf;
+#elif defined(__SSE__)
     return _mm_movemask_ps(a) == 0xf;
 #else
     for (int i = 0; i < 4; ++i) {
@@ -58,17 +83,58 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE bool all(const vboold4 &a)
+  {
+#if defined(__AVX512VL__)
+    return a.v == 0xf;
+#elif defined(__AVX__)
+    return _mm256_movemask_pd(a) == 0xf;
+#else
+    for (int i = 0; i < 4; ++i) {
+      if (!a[i])
+        return false;
+    }
+
+    return true;
+#endif
+  }
+
   // 8-wide //
 
   TSIMD_INLINE bool all(const vboolf8 &a)
   {
-#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return a.v == 0xff;
+#elif defined(__AVX__)
     return _mm256_movemask_ps(a) == (unsigned int)0xff;
 #else
     return all(vboolf4(a.vl)) && all(vboolf4(a.vh));
 #endif
   }
 
+  TSIMD_INLINE bool all(const vboold8 &a)
+  {
+#if defined(__AVX512F__)
+    return a.v == 0xff;
+#else
+    return all(vboold4(a.vl)) && all(vboold4(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool all(const vboolw8 &a)
+  {
+#if defined(__SSE__)
+    return _mm_movemask_epi8(a) == 0xffff;
+#else
+    for (int i = 0; i < 8; ++i) {
+      if (!a[i])
+        return false;
+    }
+
+    return true;
+#endif
+  }
+
   // 16-wide //
 
   TSIMD_INLINE bool all(const vboolf16 &a)
@@ -80,4 +146,70 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE bool all(const vboolb16 &a)
+  {
+#if defined(__SSE__)
+    return _mm_movemask_epi8(a) == 0xffff;
+#else
+    for (int i = 0; i < 16; ++i) {
+      if (!a[i])
+        return false;
+    }
+
+    return true;
+#endif
+  }
+
+  TSIMD_INLINE bool all(const vboolw16 &a)
+  {
+#if defined(__AVX2__)
+    return _mm256_movemask_epi8(a) == -1;
+#else
+    return all(vboolw8(a.vl)) && all(vboolw8(a.vh));
+#endif
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE bool all(const vboolb32 &a)
+  {
+#if defined(__AVX2__)
+    return _mm256_movemask_epi8(a) == -1;
+#else
+    return all(vboolb16(a.vl)) && all(vboolb16(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool all(const vboolw32 &a)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movepi16_mask(a) == 0xffffffff;
+#else
+    return all(vboolw16(a.vl)) && all(vboolw16(a.vh));
+#endif
+  }
+
+  // 64-wide //
+
+  TSIMD_INLINE bool all(const vboolb64 &a)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movepi8_mask(a) == 0xffffffffffffffff;
+#else
+    return all(vboolb32(a.vl)) && all(vboolb32(a.vh));
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename T,
+            int W,
+            typename = traits::is_bool_t<T>,
+            typename = traits::has_halves_t<W>>
+  TSIMD_INLINE bool all(const pack<T, W> &a)
+  {
+    using half_mask = pack<T, W / 2>;
+    return all(half_mask(a.vl)) && all(half_mask(a.vh));
+  }
+
 }  // namespace tsimd
\ No newline at end of file
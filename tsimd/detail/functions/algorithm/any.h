@@ -36,11 +36,26 @@ namespace tsimd {
     return a[0];
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE bool any(const vboold2 &a)
+  {
+#if defined(__AVX512VL__)
+    return a.v != 0x0;
+#elif defined(__SSE__)
+    return _mm_movemask_pd(a) != 0x0;
+#else
+    return a[0] || a[1];
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE bool any(const vboolf4 &a)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return a.v != 0x0;
+#elif defined(__SSE__)
     return _mm_movemask_ps(a) != 0x0;
 #else
     for (int i = 0; i < 4; ++i) {
@@ -52,17 +67,58 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE bool any(const vboold4 &a)
+  {
+#if defined(__AVX512VL__)
+    return a.v != 0x0;
+#elif defined(__AVX__)
+    return !_mm256_testz_pd(a, a);
+#else
+    for (int i = 0; i < 4; ++i) {
+      if (a[i])
+        return true;
+    }
+
+    return false;
+#endif
+  }
+
   // 8-wide //
 
   TSIMD_INLINE bool any(const vboolf8 &a)
   {
-#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return a.v != 0x0;
+#elif defined(__AVX__)
     return !_mm256_testz_ps(a, a);
 #else
     return any(vboolf4(a.vl)) || any(vboolf4(a.vh));
 #endif
   }
 
+  TSIMD_INLINE bool any(const vboold8 &a)
+  {
+#if defined(__AVX512F__)
+    return _mm512_kortestz(a, a) == 0;
+#else
+    return any(vboold4(a.vl)) || any(vboold4(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool any(const vboolw8 &a)
+  {
+#if defined(__SSE__)
+    return _mm_movemask_epi8(a) != 0x0;
+#else
+    for (int i = 0; i < 8; ++i) {
+      if (a[i])
+        return true;
+    }
+
+    return false;
+#endif
+  }
+
   // 16-wide //
 
   TSIMD_INLINE bool any(const vboolf16 &a)
@@ -74,6 +130,72 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE bool any(const vboolb16 &a)
+  {
+#if defined(__SSE__)
+    return _mm_movemask_epi8(a) != 0x0;
+#else
+    for (int i = 0; i < 16; ++i) {
+      if (a[i])
+        return true;
+    }
+
+    return false;
+#endif
+  }
+
+  TSIMD_INLINE bool any(const vboolw16 &a)
+  {
+#if defined(__AVX2__)
+    return _mm256_movemask_epi8(a) != 0x0;
+#else
+    return any(vboolw8(a.vl)) || any(vboolw8(a.vh));
+#endif
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE bool any(const vboolb32 &a)
+  {
+#if defined(__AVX2__)
+    return _mm256_movemask_epi8(a) != 0x0;
+#else
+    return any(vboolb16(a.vl)) || any(vboolb16(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool any(const vboolw32 &a)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movepi16_mask(a) != 0x0;
+#else
+    return any(vboolw16(a.vl)) || any(vboolw16(a.vh));
+#endif
+  }
+
+  // 64-wide //
+
+  TSIMD_INLINE bool any(const vboolb64 &a)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movepi8_mask(a) != 0x0;
+#else
+    return any(vboolb32(a.vl)) || any(vboolb32(a.vh));
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename T,
+            int W,
+            typename = traits::is_bool_t<T>,
+            typename = traits::has_halves_t<W>>
+  TSIMD_INLINE bool any(const pack<T, W> &a)
+  {
+    using half_mask = pack<T, W / 2>;
+    return any(half_mask(a.vl)) || any(half_mask(a.vh));
+  }
+
   // none() ///////////////////////////////////////////////////////////////////
 
   template <typename MASK_T, typename = traits::is_mask_t<MASK_T>>
@@ -30,11 +30,34 @@
 
 namespace tsimd {
 
+  namespace detail {
+
+    template <typename PACK_T, typename FCN_T>
+    TSIMD_INLINE void foreach(PACK_T &p, FCN_T &&fcn, std::false_type)
+    {
+      for (int i = 0; i < PACK_T::static_size; ++i)
+        fcn(p[i], i);
+    }
+
+    // k-register masks have no addressable elements, so each element is
+    // passed through a temporary and written back
+    template <typename PACK_T, typename FCN_T>
+    TSIMD_INLINE void foreach(PACK_T &p, FCN_T &&fcn, std::true_type)
+    {
+      for (int i = 0; i < PACK_T::static_size; ++i) {
+        typename PACK_T::value_t v(p[i]);
+        fcn(v, i);
+        p[i] = v;
+      }
+    }
+
+  }  // namespace detail
+
   template <typename T, int W, typename FCN_T>
   TSIMD_INLINE void foreach(pack<T, W> &p, FCN_T && fcn)
   {
-    for (int i = 0; i < W; ++i)
-      fcn(p[i], i);
+    detail::foreach(
+        p, std::forward<FCN_T>(fcn), typename pack<T, W>::is_kmask());
   }
 
   template <typename BOOL_T,
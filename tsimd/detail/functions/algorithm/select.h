@@ -38,13 +38,59 @@ namespace tsimd {
     return pack<T, 1>(m[0] ? t[0] : f[0]);
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 select(const vboold2 &m,
+                               const vdouble2 &t,
+                               const vdouble2 &f)
+  {
+#if defined(__AVX512VL__)
+    return _mm_mask_blend_pd(m, f, t);
+#elif defined(__SSE4_1__)
+    return _mm_blendv_pd(f, t, m);
+#elif defined(__SSE__)
+    return _mm_or_pd(_mm_and_pd(m, t), _mm_andnot_pd(m, f));
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong2 select(const vboold2 &m,
+                              const vllong2 &t,
+                              const vllong2 &f)
+  {
+#if defined(__AVX512VL__)
+    return _mm_mask_blend_epi64(m, f, t);
+#elif defined(__SSE4_1__)
+    return _mm_castpd_si128(_mm_blendv_pd(
+        _mm_castsi128_pd(f), _mm_castsi128_pd(t), m));
+#elif defined(__SSE__)
+    const __m128i mi = _mm_castpd_si128(m);
+    return _mm_or_si128(_mm_and_si128(mi, t), _mm_andnot_si128(mi, f));
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 select(const vboolf4 &m,
                               const vfloat4 &t,
                               const vfloat4 &f)
   {
-#if defined(__SSE4_1__)
+#if defined(__AVX512VL__)
+    return _mm_mask_blend_ps(m, f, t);
+#elif defined(__SSE4_1__)
     return _mm_blendv_ps(f, t, m);
 #elif defined(__SSE__)
     return _mm_or_ps(_mm_and_ps(m, t), _mm_andnot_ps(m, f));
@@ -60,7 +106,9 @@ namespace tsimd {
 
   TSIMD_INLINE vint4 select(const vboolf4 &m, const vint4 &t, const vint4 &f)
   {
-#if defined(__SSE4_1__)
+#if defined(__AVX512VL__)
+    return _mm_mask_blend_epi32(m, f.v, t.v);
+#elif defined(__SSE4_1__)
     return _mm_castps_si128(
         _mm_blendv_ps(_mm_castsi128_ps(f), _mm_castsi128_ps(t), m));
 #elif defined(__SSE__)
@@ -75,13 +123,71 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint4 select(const vboolf4 &m, const vuint4 &t, const vuint4 &f)
+  {
+#if defined(__AVX512VL__)
+    return _mm_mask_blend_epi32(m, f.v, t.v);
+#elif defined(__SSE4_1__)
+    return _mm_castps_si128(
+        _mm_blendv_ps(_mm_castsi128_ps(f), _mm_castsi128_ps(t), m));
+#elif defined(__SSE__)
+    return _mm_or_si128(_mm_and_si128(m, t), _mm_andnot_si128(m, f));
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 select(const vboold4 &m,
+                               const vdouble4 &t,
+                               const vdouble4 &f)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_mask_blend_pd(m, f, t);
+#elif defined(__AVX__)
+    return _mm256_blendv_pd(f, t, m);
+#else
+    vdouble4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong4 select(const vboold4 &m,
+                              const vllong4 &t,
+                              const vllong4 &f)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_mask_blend_epi64(m, f, t);
+#elif defined(__AVX__)
+    return _mm256_castpd_si256(
+        _mm256_blendv_pd(_mm256_castsi256_pd(f), _mm256_castsi256_pd(t), m));
+#else
+    vllong4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+#endif
+  }
+
   // 8-wide //
 
   TSIMD_INLINE vfloat8 select(const vboolf8 &m,
                               const vfloat8 &t,
                               const vfloat8 &f)
   {
-#if defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return _mm256_mask_blend_ps(m, f, t);
+#elif defined(__AVX2__) || defined(__AVX__)
     return _mm256_blendv_ps(f, t, m);
 #else
     return vfloat8(select(vboolf4(m.vl), vfloat4(t.vl), vfloat4(f.vl)),
@@ -91,7 +197,9 @@ namespace tsimd {
 
   TSIMD_INLINE vint8 select(const vboolf8 &m, const vint8 &t, const vint8 &f)
   {
-#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return _mm256_mask_blend_epi32(m, f.v, t.v);
+#elif defined(__AVX__)
     return _mm256_castps_si256(
         _mm256_blendv_ps(_mm256_castsi256_ps(f), _mm256_castsi256_ps(t), m));
 #else
@@ -100,6 +208,79 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint8 select(const vboolf8 &m, const vuint8 &t, const vuint8 &f)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_mask_blend_epi32(m, f.v, t.v);
+#elif defined(__AVX__)
+    return _mm256_castps_si256(
+        _mm256_blendv_ps(_mm256_castsi256_ps(f), _mm256_castsi256_ps(t), m));
+#else
+    return vuint8(select(vboolf4(m.vl), vuint4(t.vl), vuint4(f.vl)),
+                  select(vboolf4(m.vh), vuint4(t.vh), vuint4(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vdouble8 select(const vboold8 &m,
+                               const vdouble8 &t,
+                               const vdouble8 &f)
+  {
+#if defined(__AVX512F__)
+    return _mm512_mask_blend_pd(m, f, t);
+#else
+    return vdouble8(select(vboold4(m.vl), vdouble4(t.vl), vdouble4(f.vl)),
+                    select(vboold4(m.vh), vdouble4(t.vh), vdouble4(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 select(const vboold8 &m,
+                              const vllong8 &t,
+                              const vllong8 &f)
+  {
+#if defined(__AVX512F__)
+    return _mm512_mask_blend_epi64(m, f, t);
+#else
+    return vllong8(select(vboold4(m.vl), vllong4(t.vl), vllong4(f.vl)),
+                   select(vboold4(m.vh), vllong4(t.vh), vllong4(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort8 select(const vboolw8 &m,
+                              const vshort8 &t,
+                              const vshort8 &f)
+  {
+#if defined(__SSE4_1__)
+    return _mm_blendv_epi8(f, t, m);
+#elif defined(__SSE__)
+    return _mm_or_si128(_mm_and_si128(m, t), _mm_andnot_si128(m, f));
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 select(const vboolw8 &m,
+                               const vushort8 &t,
+                               const vushort8 &f)
+  {
+#if defined(__SSE4_1__)
+    return _mm_blendv_epi8(f, t, m);
+#elif defined(__SSE__)
+    return _mm_or_si128(_mm_and_si128(m, t), _mm_andnot_si128(m, f));
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+#endif
+  }
+
   // 16-wide //
 
   TSIMD_INLINE vfloat16 select(const vboolf16 &m,
@@ -126,6 +307,168 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint16 select(const vboolf16 &m,
+                              const vuint16 &t,
+                              const vuint16 &f)
+  {
+#if defined(__AVX512F__)
+    return _mm512_mask_or_epi32(f, m, t, t);
+#else
+    return vuint16(select(vboolf8(m.vl), vuint8(t.vl), vuint8(f.vl)),
+                   select(vboolf8(m.vh), vuint8(t.vh), vuint8(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vschar16 select(const vboolb16 &m,
+                               const vschar16 &t,
+                               const vschar16 &f)
+  {
+#if defined(__SSE4_1__)
+    return _mm_blendv_epi8(f, t, m);
+#elif defined(__SSE__)
+    return _mm_or_si128(_mm_and_si128(m, t), _mm_andnot_si128(m, f));
+#else
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuchar16 select(const vboolb16 &m,
+                               const vuchar16 &t,
+                               const vuchar16 &f)
+  {
+#if defined(__SSE4_1__)
+    return _mm_blendv_epi8(f, t, m);
+#elif defined(__SSE__)
+    return _mm_or_si128(_mm_and_si128(m, t), _mm_andnot_si128(m, f));
+#else
+    vuchar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort16 select(const vboolw16 &m,
+                               const vshort16 &t,
+                               const vshort16 &f)
+  {
+#if defined(__AVX2__)
+    return _mm256_blendv_epi8(f, t, m);
+#else
+    return vshort16(select(vboolw8(m.vl), vshort8(t.vl), vshort8(f.vl)),
+                    select(vboolw8(m.vh), vshort8(t.vh), vshort8(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 select(const vboolw16 &m,
+                                const vushort16 &t,
+                                const vushort16 &f)
+  {
+#if defined(__AVX2__)
+    return _mm256_blendv_epi8(f, t, m);
+#else
+    return vushort16(select(vboolw8(m.vl), vushort8(t.vl), vushort8(f.vl)),
+                     select(vboolw8(m.vh), vushort8(t.vh), vushort8(f.vh)));
+#endif
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE vschar32 select(const vboolb32 &m,
+                               const vschar32 &t,
+                               const vschar32 &f)
+  {
+#if defined(__AVX2__)
+    return _mm256_blendv_epi8(f, t, m);
+#else
+    return vschar32(select(vboolb16(m.vl), vschar16(t.vl), vschar16(f.vl)),
+                    select(vboolb16(m.vh), vschar16(t.vh), vschar16(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 select(const vboolb32 &m,
+                               const vuchar32 &t,
+                               const vuchar32 &f)
+  {
+#if defined(__AVX2__)
+    return _mm256_blendv_epi8(f, t, m);
+#else
+    return vuchar32(select(vboolb16(m.vl), vuchar16(t.vl), vuchar16(f.vl)),
+                    select(vboolb16(m.vh), vuchar16(t.vh), vuchar16(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 select(const vboolw32 &m,
+                               const vshort32 &t,
+                               const vshort32 &f)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mask_blend_epi16(_mm512_movepi16_mask(m), f.v, t.v);
+#else
+    return vshort32(select(vboolw16(m.vl), vshort16(t.vl), vshort16(f.vl)),
+                    select(vboolw16(m.vh), vshort16(t.vh), vshort16(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 select(const vboolw32 &m,
+                                const vushort32 &t,
+                                const vushort32 &f)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mask_blend_epi16(_mm512_movepi16_mask(m), f.v, t.v);
+#else
+    return vushort32(select(vboolw16(m.vl), vushort16(t.vl), vushort16(f.vl)),
+                     select(vboolw16(m.vh), vushort16(t.vh), vushort16(f.vh)));
+#endif
+  }
+
+  // 64-wide //
+
+  TSIMD_INLINE vschar64 select(const vboolb64 &m,
+                               const vschar64 &t,
+                               const vschar64 &f)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mask_blend_epi8(_mm512_movepi8_mask(m), f.v, t.v);
+#else
+    return vschar64(select(vboolb32(m.vl), vschar32(t.vl), vschar32(f.vl)),
+                    select(vboolb32(m.vh), vschar32(t.vh), vschar32(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 select(const vboolb64 &m,
+                               const vuchar64 &t,
+                               const vuchar64 &f)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mask_blend_epi8(_mm512_movepi8_mask(m), f.v, t.v);
+#else
+    return vuchar64(select(vboolb32(m.vl), vuchar32(t.vl), vuchar32(f.vl)),
+                    select(vboolb32(m.vh), vuchar32(t.vh), vuchar32(f.vh)));
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename T, int W, typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> select(const mask<T, W> &m,
+                                 const pack<T, W> &t,
+                                 const pack<T, W> &f)
+  {
+    using half_pack = pack<T, W / 2>;
+    using half_mask = mask<T, W / 2>;
+    return pack<T, W>(
+        select(half_mask(m.vl), half_pack(t.vl), half_pack(f.vl)),
+        select(half_mask(m.vh), half_pack(t.vh), half_pack(f.vh)));
+  }
+
   // Inferred pack-scalar select //////////////////////////////////////////////
 
   template <typename T,
@@ -24,15 +24,68 @@
 
 #pragma once
 
+// Accuracy tiers //
+//
+// exp, log, sin, cos, sincos, tan, pow, sqrt and rcp come in three tiers,
+// with max errors in ulps of float results (tests/test_accuracy.cpp sweeps
+// them over every float input):
+//
+//   tsimd::fast::     cheapest kernels, bounded only on the noted domain and
+//                     without any handling of special values
+//   tsimd::           max 4 ulp on the full domain, including subnormals,
+//                     overflow, infinities and NaN
+//   tsimd::precise::  max 1 ulp, floats evaluated in double precision
+//
+//             fast                           default   precise
+//   exp       1.5  x in [-87.3, 88.3]        1.5       1
+//   log       1    normal x > 0              1         1
+//   sin, cos  2.5  |x| < 6433                2.5       1
+//   sincos
+//   tan       4    |x| < 6433                4         1
+//   pow       1 + 1.5 * |y * log(x)|         1         1
+//                  normal x > 0, normal x^y
+//   sqrt      3    0 and normal x > 0        0.5       0.5
+//   rcp       3    normal |x| < 2^126        0.5       0.5
+//
+// Double precision packs use the same code in all tiers, with max errors of
+// 1 ulp (exp, log, sin, cos), 2 ulp (tan, pow) and 0.5 ulp (sqrt, rcp).
+//
+// The default and precise trig functions reduce arguments past the fast
+// range (|x| >= 6433 for float, 2^20 * pi/2 for double) with Payne-Hanek.
+//
+// atan, atan2, asin, acos, sinh, cosh and tanh only have the default tier,
+// with max errors of 2 to 3 ulp for float and 1 ulp (atan, asin, acos) or
+// 2 ulp (atan2, sinh, cosh, tanh) for double. See the comment on each.
+//
+// rcp<N>() and rsqrt<N>() give direct access to the hardware estimates,
+// refined by N Newton-Raphson steps, and fast_div(a, b) is a * rcp<N>(b).
+//
+// NOTE: call the tiers qualified (ex: tsimd::fast::exp(x)), as argument
+//       dependent lookup also finds the tsimd:: overloads
+
 #include "math/abs.h"
+#include "math/acos.h"
+#include "math/adds.h"
+#include "math/asin.h"
+#include "math/atan.h"
+#include "math/avg.h"
 #include "math/ceil.h"
 #include "math/cos.h"
+#include "math/cosh.h"
+#include "math/dot_bf16.h"
 #include "math/exp.h"
 #include "math/floor.h"
 #include "math/log.h"
 #include "math/max.h"
 #include "math/min.h"
+#include "math/mulhi.h"
 #include "math/pow.h"
+#include "math/rcp.h"
+#include "math/rsqrt.h"
 #include "math/sin.h"
+#include "math/sincos.h"
+#include "math/sinh.h"
 #include "math/sqrt.h"
+#include "math/subs.h"
 #include "math/tan.h"
+#include "math/tanh.h"
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <cmath>
+#include <limits>
 
 #include "../../pack.h"
 
@@ -38,6 +39,40 @@ namespace tsimd {
     return pack<T, 1>(std::abs(p[0]));
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 abs(const vdouble2 &p)
+  {
+#if defined(__SSE__)
+    return _mm_and_pd(
+        p, _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffff)));
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = std::abs(p[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong2 abs(const vllong2 &p)
+  {
+#if defined(__AVX512VL__)
+    return _mm_abs_epi64(p);
+#elif defined(__SSE4_2__)
+    const __m128i s = _mm_cmpgt_epi64(_mm_setzero_si128(), p);
+    return _mm_sub_epi64(_mm_xor_si128(p, s), s);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = std::abs(p[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 abs(const vfloat4 &p)
@@ -68,6 +103,43 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vdouble4 abs(const vdouble4 &p)
+  {
+#if defined(__AVX__)
+    return _mm256_and_pd(
+        p, _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffff)));
+#else
+    vdouble4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = std::abs(p[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong4 abs(const vllong4 &p)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_abs_epi64(p);
+#elif defined(__AVX2__)
+    const __m256i s = _mm256_cmpgt_epi64(_mm256_setzero_si256(), p);
+    return _mm256_sub_epi64(_mm256_xor_si256(p, s), s);
+#elif defined(__AVX__)
+    const __m128i sl = _mm_cmpgt_epi64(_mm_setzero_si128(), p.vl);
+    const __m128i sh = _mm_cmpgt_epi64(_mm_setzero_si128(), p.vh);
+    return vllong4(_mm_sub_epi64(_mm_xor_si128(p.vl, sl), sl),
+                   _mm_sub_epi64(_mm_xor_si128(p.vh, sh), sh));
+#else
+    vllong4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = std::abs(p[i]);
+
+    return result;
+#endif
+  }
+
   // 8-wide //
 
   TSIMD_INLINE vfloat8 abs(const vfloat8 &p)
@@ -90,6 +162,26 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vdouble8 abs(const vdouble8 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_castsi512_pd(
+      _mm512_and_epi64(
+        _mm512_castpd_si512(p), _mm512_set1_epi64(0x7fffffffffffffff)));
+#else
+    return vdouble8(abs(vdouble4(p.vl)), abs(vdouble4(p.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 abs(const vllong8 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_abs_epi64(p);
+#else
+    return vllong8(abs(vllong4(p.vl)), abs(vllong4(p.vh)));
+#endif
+  }
+
   // 16-wide //
 
   TSIMD_INLINE vfloat16 abs(const vfloat16 &p)
@@ -112,4 +204,38 @@ namespace tsimd {
 #endif
   }
 
+  // Composite widths //
+
+  template <typename T, int W, typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> abs(const pack<T, W> &p)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(abs(half_pack(p.vl)), abs(half_pack(p.vh)));
+  }
+
+  namespace detail {
+
+    // x with its sign flipped in the lanes where s has its sign bit set,
+    // ie. mulsign(abs(x), s) == copysign(x, s)
+    template <int W>
+    TSIMD_INLINE vfloatn<W> mulsign(const vfloatn<W> &x, const vfloatn<W> &s)
+    {
+      const auto sign = reinterpret_elements_as<int>(s) &
+                        std::numeric_limits<int>::min();
+      return reinterpret_elements_as<float>(reinterpret_elements_as<int>(x) ^
+                                            sign);
+    }
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> mulsign(const vdoublen<W> &x,
+                                     const vdoublen<W> &s)
+    {
+      const auto sign = reinterpret_elements_as<long long>(s) &
+                        std::numeric_limits<long long>::min();
+      return reinterpret_elements_as<double>(
+          reinterpret_elements_as<long long>(x) ^ sign);
+    }
+
+  }  // namespace detail
+
 }  // namespace tsimd
\ No newline at end of file
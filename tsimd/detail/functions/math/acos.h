@@ -0,0 +1,113 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cmath>
+
+#include "../../pack.h"
+
+#include "../algorithm/select.h"
+
+#include "abs.h"
+#include "asin.h"
+#include "sqrt.h"
+
+namespace tsimd {
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> acos(const pack<T, W> &p)
+  {
+    pack<T, W> result;
+
+#if TSIMD_USE_OPENMP
+#  pragma omp simd
+#endif
+    for (int i = 0; i < W; ++i)
+      result[i] = std::acos(p[i]);
+
+    return result;
+  }
+
+  // Single precision //
+
+  // Max error 2 ulp, NaN for |x| > 1
+  template <int W>
+  TSIMD_INLINE vfloatn<W> acos(const vfloatn<W> &p)
+  {
+    // pi/2 and pi, split in two
+    static const float pio2_hi = 1.57079637050628662109f;
+    static const float pio2_lo = -4.37113900018624283e-8f;
+    static const float pi_hi   = 3.14159274101257324219f;
+    static const float pi_lo   = -8.74227800037248734002e-8f;
+
+    const auto a   = abs(p);
+    const auto big = a > 0.5f;
+
+    const auto z = select(big, 0.5f * (1.f - a), a * a);
+    const auto s = select(big, sqrt(z), a);
+    const auto r = detail::asin_kernel(s, z);
+
+    // x > 0.5: 2 * asin(sqrt((1 - x) / 2)), x < -0.5: pi minus that,
+    // otherwise pi/2 - asin(x)
+    const auto small = pio2_hi - (detail::mulsign(r, p) - pio2_lo);
+    const auto pos   = r + r;
+    const auto neg   = (pi_hi - pos) + pi_lo;
+
+    return select(big, select(p < 0.f, neg, pos), small);
+  }
+
+  // Double precision //
+
+  // Max error 1 ulp, NaN for |x| > 1
+  template <int W>
+  TSIMD_INLINE vdoublen<W> acos(const vdoublen<W> &p)
+  {
+    static const double pio2_hi = 1.57079632679489655800e+00;
+    static const double pio2_lo = 6.12323399573676603587e-17;
+    static const double pi      = 3.14159265358979311600e+00;
+
+    const auto a   = abs(p);
+    const auto big = a >= 0.5;
+
+    const auto z = select(big, 0.5 * (1.0 - a), a * a);
+    const auto s = select(big, sqrt(z), a);
+    const auto r = detail::asin_rational(z);
+
+    // |x| < 0.5: pi/2 - asin(x)
+    const auto small = pio2_hi - (p - (pio2_lo - p * r));
+
+    // x <= -0.5: pi - 2 * asin(sqrt((1 + x) / 2))
+    const auto neg = pi - 2.0 * (s + (r * s - pio2_lo));
+
+    // x >= 0.5: 2 * asin(sqrt((1 - x) / 2)), with the rounding error of s
+    // added back in (c = 0 for x = 1)
+    const auto f   = detail::clear_low_bits(s);
+    const auto c   = select(z == 0.0, z, (z - f * f) / (s + f));
+    const auto pos = 2.0 * (f + (r * s + c));
+
+    return select(big, select(p < 0.0, neg, pos), small);
+  }
+
+}  // namespace tsimd
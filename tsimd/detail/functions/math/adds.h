@@ -0,0 +1,212 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include "../../pack.h"
+
+namespace tsimd {
+
+  namespace detail {
+
+    // clamp a widened intermediate back into the range of T
+    template <typename T, typename WIDE_T>
+    TSIMD_INLINE T saturate_cast(WIDE_T v)
+    {
+      return T(std::min<WIDE_T>(
+          std::max<WIDE_T>(v, std::numeric_limits<T>::min()),
+          std::numeric_limits<T>::max()));
+    }
+
+  }  // namespace detail
+
+  // 1-wide //
+
+  template <typename T, typename = traits::enable_if_t<sizeof(T) <= 2>>
+  TSIMD_INLINE pack<T, 1> adds(const pack<T, 1> &p1, const pack<T, 1> &p2)
+  {
+    return pack<T, 1>(detail::saturate_cast<T>(int(p1[0]) + int(p2[0])));
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vshort8 adds(const vshort8 &p1, const vshort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_adds_epi16(p1, p2);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = detail::saturate_cast<int16_t>(int(p1[i]) + int(p2[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 adds(const vushort8 &p1, const vushort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_adds_epu16(p1, p2);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = detail::saturate_cast<uint16_t>(int(p1[i]) + int(p2[i]));
+
+    return result;
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vschar16 adds(const vschar16 &p1, const vschar16 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_adds_epi8(p1, p2);
+#else
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = detail::saturate_cast<int8_t>(int(p1[i]) + int(p2[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuchar16 adds(const vuchar16 &p1, const vuchar16 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_adds_epu8(p1, p2);
+#else
+    vuchar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = detail::saturate_cast<uint8_t>(int(p1[i]) + int(p2[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort16 adds(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_adds_epi16(p1, p2);
+#else
+    return vshort16(adds(vshort8(p1.vl), vshort8(p2.vl)),
+                    adds(vshort8(p1.vh), vshort8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 adds(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_adds_epu16(p1, p2);
+#else
+    return vushort16(adds(vushort8(p1.vl), vushort8(p2.vl)),
+                     adds(vushort8(p1.vh), vushort8(p2.vh)));
+#endif
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE vschar32 adds(const vschar32 &p1, const vschar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_adds_epi8(p1, p2);
+#else
+    return vschar32(adds(vschar16(p1.vl), vschar16(p2.vl)),
+                    adds(vschar16(p1.vh), vschar16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 adds(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_adds_epu8(p1, p2);
+#else
+    return vuchar32(adds(vuchar16(p1.vl), vuchar16(p2.vl)),
+                    adds(vuchar16(p1.vh), vuchar16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 adds(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_adds_epi16(p1, p2);
+#else
+    return vshort32(adds(vshort16(p1.vl), vshort16(p2.vl)),
+                    adds(vshort16(p1.vh), vshort16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 adds(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_adds_epu16(p1, p2);
+#else
+    return vushort32(adds(vushort16(p1.vl), vushort16(p2.vl)),
+                     adds(vushort16(p1.vh), vushort16(p2.vh)));
+#endif
+  }
+
+  // 64-wide //
+
+  TSIMD_INLINE vschar64 adds(const vschar64 &p1, const vschar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_adds_epi8(p1, p2);
+#else
+    return vschar64(adds(vschar32(p1.vl), vschar32(p2.vl)),
+                    adds(vschar32(p1.vh), vschar32(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 adds(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_adds_epu8(p1, p2);
+#else
+    return vuchar64(adds(vuchar32(p1.vl), vuchar32(p2.vl)),
+                    adds(vuchar32(p1.vh), vuchar32(p2.vh)));
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename T,
+            int W,
+            typename = traits::enable_if_t<sizeof(T) <= 2>,
+            typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> adds(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(adds(half_pack(p1.vl), half_pack(p2.vl)),
+                      adds(half_pack(p1.vh), half_pack(p2.vh)));
+  }
+
+}  // namespace tsimd
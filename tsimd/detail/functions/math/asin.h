@@ -0,0 +1,169 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cmath>
+
+#include "../../pack.h"
+
+#include "../algorithm/select.h"
+
+#include "abs.h"
+#include "sqrt.h"
+
+namespace tsimd {
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> asin(const pack<T, W> &p)
+  {
+    pack<T, W> result;
+
+#if TSIMD_USE_OPENMP
+#  pragma omp simd
+#endif
+    for (int i = 0; i < W; ++i)
+      result[i] = std::asin(p[i]);
+
+    return result;
+  }
+
+  // Single precision //
+
+  namespace detail {
+
+    // asin(s) for s in [0, 0.5], z = s^2 (cephes asinf). Larger arguments
+    // use asin(a) = pi/2 - 2 * asin(sqrt((1 - a) / 2)).
+    template <int W>
+    TSIMD_INLINE vfloatn<W> asin_kernel(const vfloatn<W> &s,
+                                        const vfloatn<W> &z)
+    {
+      auto p = z * 4.2163199048E-2f + 2.4181311049E-2f;
+      p      = z * p + 4.5470025998E-2f;
+      p      = z * p + 7.4953002686E-2f;
+      p      = z * p + 1.6666752422E-1f;
+      return (p * z) * s + s;
+    }
+
+  }  // namespace detail
+
+  // Max error 2.5 ulp, NaN for |x| > 1
+  template <int W>
+  TSIMD_INLINE vfloatn<W> asin(const vfloatn<W> &p)
+  {
+    // pi/2, split in two
+    static const float pio2_hi = 1.57079637050628662109f;
+    static const float pio2_lo = -4.37113900018624283e-8f;
+
+    const auto a   = abs(p);
+    const auto big = a > 0.5f;
+
+    const auto z = select(big, 0.5f * (1.f - a), a * a);
+    const auto s = select(big, sqrt(z), a);
+    const auto r = detail::asin_kernel(s, z);
+
+    const auto result = select(big, (pio2_hi - (r + r)) + pio2_lo, r);
+    return detail::mulsign(result, p);
+  }
+
+  // Double precision //
+
+  namespace detail {
+
+    // fdlibm's rational approximation R(z) with
+    // asin(s) = s + s * R(s^2) for s in [0, 0.5]
+    template <int W>
+    TSIMD_INLINE vdoublen<W> asin_rational(const vdoublen<W> &z)
+    {
+      static const double pS0 = 1.66666666666666657415e-01;
+      static const double pS1 = -3.25565818622400915405e-01;
+      static const double pS2 = 2.01212532134862925881e-01;
+      static const double pS3 = -4.00555345006794114027e-02;
+      static const double pS4 = 7.91534994289814532176e-04;
+      static const double pS5 = 3.47933107596021167570e-05;
+
+      static const double qS1 = -2.40339491173441421878e+00;
+      static const double qS2 = 2.02094576023350569471e+00;
+      static const double qS3 = -6.88283971605453293030e-01;
+      static const double qS4 = 7.70381505559019352791e-02;
+
+      auto p = z * pS5 + pS4;
+      p      = z * p + pS3;
+      p      = z * p + pS2;
+      p      = z * p + pS1;
+      p      = z * p + pS0;
+
+      auto q = z * qS4 + qS3;
+      q      = z * q + qS2;
+      q      = z * q + qS1;
+      q      = z * q + 1.0;
+
+      return (z * p) / q;
+    }
+
+    // s with the low 32 bits of its mantissa cleared, so s_hi^2 is exact
+    template <int W>
+    TSIMD_INLINE vdoublen<W> clear_low_bits(const vdoublen<W> &s)
+    {
+      static const long long hiMask = 0xffffffff00000000ll;
+
+      return reinterpret_elements_as<double>(
+          reinterpret_elements_as<long long>(s) & hiMask);
+    }
+
+  }  // namespace detail
+
+  // Max error 1 ulp, NaN for |x| > 1
+  template <int W>
+  TSIMD_INLINE vdoublen<W> asin(const vdoublen<W> &p)
+  {
+    static const double pio2_hi = 1.57079632679489655800e+00;
+    static const double pio2_lo = 6.12323399573676603587e-17;
+    static const double pio4_hi = 7.85398163397448278999e-01;
+
+    const auto a   = abs(p);
+    const auto big = a >= 0.5;
+
+    const auto z = select(big, 0.5 * (1.0 - a), a * a);
+    const auto s = select(big, sqrt(z), a);
+    const auto r = detail::asin_rational(z);
+
+    // |x| < 0.5
+    const auto small = s + s * r;
+
+    // |x| >= 0.975
+    const auto nearOne = pio2_hi - (2.0 * (s + s * r) - pio2_lo);
+
+    // 0.5 <= |x| < 0.975, with the rounding error of s added back in
+    const auto f   = detail::clear_low_bits(s);
+    const auto c   = (z - f * f) / (s + f);
+    const auto t   = 2.0 * s * r - (pio2_lo - 2.0 * c);
+    const auto u   = pio4_hi - 2.0 * f;
+    const auto mid = pio4_hi - (t - u);
+
+    const auto result = select(big, select(a >= 0.975, nearOne, mid), small);
+    return detail::mulsign(result, p);
+  }
+
+}  // namespace tsimd
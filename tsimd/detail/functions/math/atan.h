@@ -0,0 +1,225 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+#include "../../pack.h"
+
+#include "../algorithm/select.h"
+
+#include "abs.h"
+
+namespace tsimd {
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> atan(const pack<T, W> &p)
+  {
+    pack<T, W> result;
+
+#if TSIMD_USE_OPENMP
+#  pragma omp simd
+#endif
+    for (int i = 0; i < W; ++i)
+      result[i] = std::atan(p[i]);
+
+    return result;
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> atan2(const pack<T, W> &y, const pack<T, W> &x)
+  {
+    pack<T, W> result;
+
+#if TSIMD_USE_OPENMP
+#  pragma omp simd
+#endif
+    for (int i = 0; i < W; ++i)
+      result[i] = std::atan2(y[i], x[i]);
+
+    return result;
+  }
+
+  // Single precision //
+
+  namespace detail {
+
+    // atan(t) for t >= 0 (cephes atanf): t is reduced to [0, tan(pi/8)]
+    // with atan(t) = pi/4 + atan((t - 1) / (t + 1)) and
+    // atan(t) = pi/2 - atan(1 / t)
+    template <int W>
+    TSIMD_INLINE vfloatn<W> atan_kernel(const vfloatn<W> &t)
+    {
+      const auto big = t > 2.414213562373095f;
+      const auto mid = t > 0.4142135623730950f;
+
+      auto x = select(mid, (t - 1.f) / (t + 1.f), t);
+      x      = select(big, -1.f / t, x);
+
+      // pi/4 and pi/2, split in two
+      const vfloatn<W> pio4_hi(0.785398185253143310547f);
+      const vfloatn<W> pio4_lo(-2.18556950009312141501e-8f);
+      const vfloatn<W> pio2_hi(1.57079637050628662109f);
+      const vfloatn<W> pio2_lo(-4.37113900018624283e-8f);
+
+      auto y  = select(mid, pio4_hi, vfloatn<W>(0.f));
+      y       = select(big, pio2_hi, y);
+      auto lo = select(mid, pio4_lo, vfloatn<W>(0.f));
+      lo      = select(big, pio2_lo, lo);
+
+      const auto z = x * x;
+
+      auto p = z * 8.05374449538e-2f - 1.38776856032E-1f;
+      p      = z * p + 1.99777106478E-1f;
+      p      = z * p - 3.33329491539E-1f;
+      return y + (((p * z) * x + lo) + x);
+    }
+
+  }  // namespace detail
+
+  // Max error 2.5 ulp, atan(+-inf) = +-pi/2
+  template <int W>
+  TSIMD_INLINE vfloatn<W> atan(const vfloatn<W> &p)
+  {
+    return detail::mulsign(detail::atan_kernel(abs(p)), p);
+  }
+
+  // Max error 3 ulp, with the C99 results for zeros and infinities
+  template <int W>
+  TSIMD_INLINE vfloatn<W> atan2(const vfloatn<W> &y, const vfloatn<W> &x)
+  {
+    const auto ax = abs(x);
+    const auto ay = abs(y);
+
+    // 0 / 0 and inf / inf have the angles of 0 / 1 and 1 / 1
+    const auto inf = std::numeric_limits<float>::infinity();
+    auto t         = ay / ax;
+    t              = select(ay == 0.f, vfloatn<W>(0.f), t);
+    t              = select(ay == inf & ax == inf, vfloatn<W>(1.f), t);
+
+    // atan(t) in [0, pi/2], mirrored into [pi/2, pi] for x < 0 (incl. -0)
+    const auto a = detail::atan_kernel(t);
+    const auto angle =
+        select(detail::mulsign(vfloatn<W>(1.f), x) < 0.f,
+               (3.14159274101257324219f - a) - 8.74227800037248734002e-8f,
+               a);
+
+    // Keep t = inf (x = 0 or y = inf) at exactly pi/2 for both signs of x
+    const auto result = detail::mulsign(
+        select(t == inf, vfloatn<W>(1.57079632679489661923f), angle), y);
+    return select(x != x | y != y, x + y, result);
+  }
+
+  // Double precision //
+
+  namespace detail {
+
+    // atan(t) for t >= 0 (cephes atan): t is reduced to [0, 0.66] with
+    // atan(t) = pi/4 + atan((t - 1) / (t + 1)) and atan(t) = pi/2 - atan(1/t),
+    // then approximated by t + t^3 * P(t^2) / Q(t^2)
+    template <int W>
+    TSIMD_INLINE vdoublen<W> atan_kernel(const vdoublen<W> &t)
+    {
+      static const double P0 = -8.750608600031904122785E-1;
+      static const double P1 = -1.615753718733365076637E1;
+      static const double P2 = -7.500855792314704667340E1;
+      static const double P3 = -1.228866684490136173410E2;
+      static const double P4 = -6.485021904942025371773E1;
+
+      static const double Q0 = 2.485846490142306297962E1;
+      static const double Q1 = 1.650270098316988542046E2;
+      static const double Q2 = 4.328810604912902668951E2;
+      static const double Q3 = 4.853903996359136964868E2;
+      static const double Q4 = 1.945506571482613964425E2;
+
+      // pi/2 and pi/4, split in two
+      static const double pio2    = 1.57079632679489661923;
+      static const double pio4    = 7.85398163397448309616E-1;
+      static const double pio2_lo = 6.123233995736765886130E-17;
+
+      const auto big = t > 2.41421356237309504880;
+      const auto mid = t > 0.66;
+
+      auto x = select(mid, (t - 1.0) / (t + 1.0), t);
+      x      = select(big, -1.0 / t, x);
+
+      auto y  = select(mid, vdoublen<W>(pio4), vdoublen<W>(0.0));
+      y       = select(big, vdoublen<W>(pio2), y);
+      auto lo = select(mid, vdoublen<W>(0.5 * pio2_lo), vdoublen<W>(0.0));
+      lo      = select(big, vdoublen<W>(pio2_lo), lo);
+
+      const auto z = x * x;
+
+      auto p = z * P0 + P1;
+      p      = z * p + P2;
+      p      = z * p + P3;
+      p      = z * p + P4;
+
+      auto q = z + Q0;
+      q      = z * q + Q1;
+      q      = z * q + Q2;
+      q      = z * q + Q3;
+      q      = z * q + Q4;
+
+      return y + ((x * (z * p / q) + lo) + x);
+    }
+
+  }  // namespace detail
+
+  // Max error 1 ulp, atan(+-inf) = +-pi/2
+  template <int W>
+  TSIMD_INLINE vdoublen<W> atan(const vdoublen<W> &p)
+  {
+    return detail::mulsign(detail::atan_kernel(abs(p)), p);
+  }
+
+  // Max error 2 ulp, with the C99 results for zeros and infinities
+  template <int W>
+  TSIMD_INLINE vdoublen<W> atan2(const vdoublen<W> &y, const vdoublen<W> &x)
+  {
+    const auto ax = abs(x);
+    const auto ay = abs(y);
+
+    // 0 / 0 and inf / inf have the angles of 0 / 1 and 1 / 1
+    const auto inf = std::numeric_limits<double>::infinity();
+    auto t         = ay / ax;
+    t              = select(ay == 0.0, vdoublen<W>(0.0), t);
+    t              = select(ay == inf & ax == inf, vdoublen<W>(1.0), t);
+
+    // atan(t) in [0, pi/2], mirrored into [pi/2, pi] for x < 0 (incl. -0)
+    const auto a = detail::atan_kernel(t);
+    const auto angle =
+        select(detail::mulsign(vdoublen<W>(1.0), x) < 0.0,
+               (3.14159265358979311600 - a) + 1.22464679914735317723e-16,
+               a);
+
+    // Keep t = inf (x = 0 or y = inf) at exactly pi/2 for both signs of x
+    const auto result = detail::mulsign(
+        select(t == inf, vdoublen<W>(1.57079632679489661923), angle), y);
+    return select(x != x | y != y, x + y, result);
+  }
+
+}  // namespace tsimd
@@ -0,0 +1,133 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <type_traits>
+
+#include "../../pack.h"
+
+namespace tsimd {
+
+  // 1-wide //
+
+  template <typename T,
+            typename = traits::enable_if_t<std::is_unsigned<T>::value &&
+                                           sizeof(T) <= 2>>
+  TSIMD_INLINE pack<T, 1> avg(const pack<T, 1> &p1, const pack<T, 1> &p2)
+  {
+    return pack<T, 1>((int(p1[0]) + int(p2[0]) + 1) >> 1);
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vushort8 avg(const vushort8 &p1, const vushort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_avg_epu16(p1, p2);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = (int(p1[i]) + int(p2[i]) + 1) >> 1;
+
+    return result;
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vuchar16 avg(const vuchar16 &p1, const vuchar16 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_avg_epu8(p1, p2);
+#else
+    vuchar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = (int(p1[i]) + int(p2[i]) + 1) >> 1;
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort16 avg(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_avg_epu16(p1, p2);
+#else
+    return vushort16(avg(vushort8(p1.vl), vushort8(p2.vl)),
+                     avg(vushort8(p1.vh), vushort8(p2.vh)));
+#endif
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE vuchar32 avg(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_avg_epu8(p1, p2);
+#else
+    return vuchar32(avg(vuchar16(p1.vl), vuchar16(p2.vl)),
+                    avg(vuchar16(p1.vh), vuchar16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 avg(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_avg_epu16(p1, p2);
+#else
+    return vushort32(avg(vushort16(p1.vl), vushort16(p2.vl)),
+                     avg(vushort16(p1.vh), vushort16(p2.vh)));
+#endif
+  }
+
+  // 64-wide //
+
+  TSIMD_INLINE vuchar64 avg(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_avg_epu8(p1, p2);
+#else
+    return vuchar64(avg(vuchar32(p1.vl), vuchar32(p2.vl)),
+                    avg(vuchar32(p1.vh), vuchar32(p2.vh)));
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename T,
+            int W,
+            typename = traits::enable_if_t<std::is_unsigned<T>::value &&
+                                           sizeof(T) <= 2>,
+            typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> avg(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(avg(half_pack(p1.vl), half_pack(p2.vl)),
+                      avg(half_pack(p1.vh), half_pack(p2.vh)));
+  }
+
+}  // namespace tsimd
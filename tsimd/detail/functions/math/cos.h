@@ -30,7 +30,7 @@
 
 #include "../algorithm/select.h"
 
-#include "floor.h"
+#include "sin.h"
 
 namespace tsimd {
 
@@ -48,51 +48,95 @@ namespace tsimd {
     return result;
   }
 
+  // Single precision //
+
+  namespace detail {
+
+    template <int W>
+    TSIMD_INLINE vfloatn<W> cos_reduced(const vfloatn<W> &r,
+                                        const vintn<W> &q)
+    {
+      const auto s = sin_kernel(r);
+      const auto c = cos_kernel(r);
+
+      // q: 0 -> cos(r), 1 -> -sin(r), 2 -> -cos(r), 3 -> sin(r)
+      auto result = select((q & 1) == 1, s, c);
+      return select(((q + 1) & 2) != 0, -result, result);
+    }
+
+  }  // namespace detail
+
+  namespace fast {
+
+    // Max error 2.5 ulp for |x| < 6433, no handling of larger |x|, infinity
+    // or NaN
+    template <int W>
+    TSIMD_INLINE vfloatn<W> cos(const vfloatn<W> &p)
+    {
+      vfloatn<W> r;
+      vintn<W> q;
+      detail::trig_reduce(p, r, q);
+      return detail::cos_reduced(r, q);
+    }
+
+  }  // namespace fast
+
+  // Double precision //
+
+  template <int W>
+  TSIMD_INLINE vdoublen<W> cos(const vdoublen<W> &p)
+  {
+    vdoublen<W> r, q;
+    detail::trig_reduce(p, r, q);
+    detail::trig_reduce_large(p, r, q);
+
+    const auto s = detail::sin_kernel(r);
+    const auto c = detail::cos_kernel(r);
+
+    // q: 0 -> cos(r), 1 -> -sin(r), 2 -> -cos(r), 3 -> sin(r)
+    const auto useSin   = (q == 1.0) | (q == 3.0);
+    const auto flipSign = (q == 1.0) | (q == 2.0);
+
+    const auto result = select(useSin, s, c);
+    return select(flipSign, -result, result);
+  }
+
+  // Max error 2.5 ulp, lanes with |x| >= 6433 are reduced with Payne-Hanek
   template <int W>
   TSIMD_INLINE vfloatn<W> cos(const vfloatn<W> &p)
   {
-    static const float piOverTwoVec = 1.57079637050628662109375;
-    static const float twoOverPiVec = 0.636619746685028076171875;
-    const auto scaled = p * twoOverPiVec;
-    const auto kReal = floor(scaled);
-    const auto k = vintn<W>(kReal);
-
-    // Reduced range version of x
-    const auto x = p - kReal * piOverTwoVec;
-
-    const auto kMod4 = k & 3;
-    const auto cosUseCos = (kMod4 == 0 | kMod4 == 2);
-    const auto flipSign = (kMod4 == 1 | kMod4 == 2);
-
-    static const float sinC2 = -0.16666667163372039794921875;
-    static const float sinC4 = 8.333347737789154052734375e-3;
-    static const float sinC6 = -1.9842604524455964565277099609375e-4;
-    static const float sinC8 = 2.760012648650445044040679931640625e-6;
-    static const float sinC10 = -2.50293279435709337121807038784027099609375e-8;
-
-    static const float cosC2 = -0.5;
-    static const float cosC4 = 4.166664183139801025390625e-2;
-    static const float cosC6 = -1.388833043165504932403564453125e-3;
-    static const float cosC8 = 2.47562347794882953166961669921875e-5;
-    static const float cosC10 = -2.59630184018533327616751194000244140625e-7;
-
-    const auto outside = select(cosUseCos, 1., x);
-    const auto c2 = select(cosUseCos, vfloatn<W>(cosC2), vfloatn<W>(sinC2));
-    const auto c4 = select(cosUseCos, vfloatn<W>(cosC4), vfloatn<W>(sinC4));
-    const auto c6 = select(cosUseCos, vfloatn<W>(cosC6), vfloatn<W>(sinC6));
-    const auto c8 = select(cosUseCos, vfloatn<W>(cosC8), vfloatn<W>(sinC8));
-    const auto c10 = select(cosUseCos, vfloatn<W>(cosC10), vfloatn<W>(sinC10));
-
-    const auto x2 = x * x;
-    auto formula = x2 * c10 + c8;
-    formula = x2 * formula + c6;
-    formula = x2 * formula + c4;
-    formula = x2 * formula + c2;
-    formula = x2 * formula + 1.;
-    formula *= outside;
-
-    formula = select(flipSign, -formula, formula);
-    return formula;
+    vfloatn<W> r;
+    vintn<W> q;
+    detail::trig_reduce(p, r, q);
+    detail::trig_reduce_large(p, r, q);
+    return detail::cos_reduced(r, q);
   }
 
-}  // namespace tsimd
\ No newline at end of file
+  namespace fast {
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> cos(const vdoublen<W> &p)
+    {
+      return tsimd::cos(p);
+    }
+
+  }  // namespace fast
+
+  namespace precise {
+
+    // Max error 1 ulp, evaluated in double precision and rounded
+    template <int W>
+    TSIMD_INLINE vfloatn<W> cos(const vfloatn<W> &p)
+    {
+      return vfloatn<W>(tsimd::cos(vdoublen<W>(p)));
+    }
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> cos(const vdoublen<W> &p)
+    {
+      return tsimd::cos(p);
+    }
+
+  }  // namespace precise
+
+}  // namespace tsimd
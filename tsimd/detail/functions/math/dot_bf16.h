@@ -0,0 +1,151 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+
+#pragma once
+
+#include "../../bf16_t.h"
+#include "../../pack.h"
+
+namespace tsimd {
+
+  // dot_bf16() ///////////////////////////////////////////////////////////////
+
+  // Accumulate pairwise bf16 products into each float lane:
+  //
+  //   acc[i] + a[2i+1] * b[2i+1] + a[2i] * b[2i]
+  //
+  // 'a' and 'b' each point to 2 * W (unaligned) bf16 values. The products of
+  // two bf16 values are exact in fp32, so the emulation matches the AVX512BF16
+  // vdpbf16ps result except for denormals (which the instruction flushes).
+
+  // 1-wide //
+
+  TSIMD_INLINE vfloat1 dot_bf16(const vfloat1 &acc,
+                                const bf16_t *a,
+                                const bf16_t *b)
+  {
+    return vfloat1(acc[0] + float(a[1]) * float(b[1]) +
+                   float(a[0]) * float(b[0]));
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 dot_bf16(const vfloat4 &acc,
+                                const bf16_t *a,
+                                const bf16_t *b)
+  {
+#if defined(__AVX512BF16__) && defined(__AVX512VL__)
+    return _mm_dpbf16_ps(acc,
+                         (__m128bh)_mm_loadu_si128((const __m128i *)a),
+                         (__m128bh)_mm_loadu_si128((const __m128i *)b));
+#elif defined(__SSE__)
+    // the even element of each pair is the low 16 bits of a 32-bit lane
+    const __m128i odd = _mm_set1_epi32(0xffff0000);
+    const __m128i x   = _mm_loadu_si128((const __m128i *)a);
+    const __m128i y   = _mm_loadu_si128((const __m128i *)b);
+    const __m128 hi   = _mm_mul_ps(_mm_castsi128_ps(_mm_and_si128(x, odd)),
+                                   _mm_castsi128_ps(_mm_and_si128(y, odd)));
+    const __m128 lo   = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(x, 16)),
+                                   _mm_castsi128_ps(_mm_slli_epi32(y, 16)));
+    return _mm_add_ps(_mm_add_ps(acc, hi), lo);
+#else
+    vfloat4 result;
+
+    for (int i = 0; i < 4; ++i) {
+      result[i] = acc[i] + float(a[2 * i + 1]) * float(b[2 * i + 1]) +
+                  float(a[2 * i]) * float(b[2 * i]);
+    }
+
+    return result;
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 dot_bf16(const vfloat8 &acc,
+                                const bf16_t *a,
+                                const bf16_t *b)
+  {
+#if defined(__AVX512BF16__) && defined(__AVX512VL__)
+    return _mm256_dpbf16_ps(
+        acc,
+        (__m256bh)_mm256_loadu_si256((const __m256i *)a),
+        (__m256bh)_mm256_loadu_si256((const __m256i *)b));
+#elif defined(__AVX2__)
+    const __m256i odd = _mm256_set1_epi32(0xffff0000);
+    const __m256i x   = _mm256_loadu_si256((const __m256i *)a);
+    const __m256i y   = _mm256_loadu_si256((const __m256i *)b);
+    const __m256 hi =
+        _mm256_mul_ps(_mm256_castsi256_ps(_mm256_and_si256(x, odd)),
+                      _mm256_castsi256_ps(_mm256_and_si256(y, odd)));
+    const __m256 lo =
+        _mm256_mul_ps(_mm256_castsi256_ps(_mm256_slli_epi32(x, 16)),
+                      _mm256_castsi256_ps(_mm256_slli_epi32(y, 16)));
+    return _mm256_add_ps(_mm256_add_ps(acc, hi), lo);
+#else
+    return vfloat8(dot_bf16(vfloat4(acc.vl), a, b),
+                   dot_bf16(vfloat4(acc.vh), a + 8, b + 8));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vfloat16 dot_bf16(const vfloat16 &acc,
+                                 const bf16_t *a,
+                                 const bf16_t *b)
+  {
+#if defined(__AVX512BF16__)
+    return _mm512_dpbf16_ps(acc,
+                            (__m512bh)_mm512_loadu_si512(a),
+                            (__m512bh)_mm512_loadu_si512(b));
+#elif defined(__AVX512F__)
+    const __m512i odd = _mm512_set1_epi32(0xffff0000);
+    const __m512i x   = _mm512_loadu_si512(a);
+    const __m512i y   = _mm512_loadu_si512(b);
+    const __m512 hi =
+        _mm512_mul_ps(_mm512_castsi512_ps(_mm512_and_si512(x, odd)),
+                      _mm512_castsi512_ps(_mm512_and_si512(y, odd)));
+    const __m512 lo =
+        _mm512_mul_ps(_mm512_castsi512_ps(_mm512_slli_epi32(x, 16)),
+                      _mm512_castsi512_ps(_mm512_slli_epi32(y, 16)));
+    return _mm512_add_ps(_mm512_add_ps(acc, hi), lo);
+#else
+    return vfloat16(dot_bf16(vfloat8(acc.vl), a, b),
+                    dot_bf16(vfloat8(acc.vh), a + 16, b + 16));
+#endif
+  }
+
+  // Composite widths //
+
+  template <int W, typename = traits::has_halves_t<W>>
+  TSIMD_INLINE vfloatn<W> dot_bf16(const vfloatn<W> &acc,
+                                   const bf16_t *a,
+                                   const bf16_t *b)
+  {
+    return vfloatn<W>(dot_bf16(vfloatn<W / 2>(acc.vl), a, b),
+                      dot_bf16(vfloatn<W / 2>(acc.vh), a + W, b + W));
+  }
+
+}  // namespace tsimd
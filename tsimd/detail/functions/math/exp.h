@@ -28,7 +28,8 @@
 
 #include "../../pack.h"
 
-#include "floor.h"
+#include "max.h"
+#include "min.h"
 
 #include "../algorithm/select.h"
 
@@ -48,97 +49,201 @@ namespace tsimd {
     return result;
   }
 
+  // Single precision //
+
   namespace detail {
 
+    // 2^n for n in [-126, 127]
     template <int W>
-    TSIMD_INLINE vfloatn<W> ldexp(vfloatn<W> x, vintn<W> n)
+    TSIMD_INLINE vfloatn<W> pow2(const vintn<W> &n)
     {
-      vintn<W> ex(0x7F800000);
-      vintn<W> ix = reinterpret_elements_as<int>(x);
-      ex &= ix;              // extract old exponent;
-      ix = ix & ~0x7F800000u;  // clear exponent
-      n = (n << 23) + ex;
-      ix |= n; // insert new exponent
-      return reinterpret_elements_as<float>(ix);
+      return reinterpret_elements_as<float>((n + 127) << 23);
     }
 
-  } // namespace detail
+    // e^x = 2^n * e^r, with |r| <= ln(2)/2 and the cephes expf polynomial
+    // for e^r
+    template <int W>
+    TSIMD_INLINE vfloatn<W> exp_kernel(const vfloatn<W> &x, vintn<W> &n)
+    {
+      // Adding 1.5 * 2^23 rounds to an integer which then sits in the low
+      // bits of the mantissa
+      static const float shifter = 12582912.f;
+      static const int kShift    = 0x4b400000;
+
+      // ln2Hi has 9 significant bits, so z * ln2Hi is exact
+      static const float ln2Hi = 0.693359375f;
+      static const float ln2Lo = -2.12194440e-4f;
+
+      const auto t = x * 1.44269504088896341f + shifter;
+      const auto z = t - shifter;
+      n            = reinterpret_elements_as<int>(t) - kShift;
+
+      auto r = x - z * ln2Hi;
+      r -= z * ln2Lo;
+
+      auto y = r * 1.9875691500E-4f + 1.3981999507E-3f;
+      y      = r * y + 8.3334519073E-3f;
+      y      = r * y + 4.1665795894E-2f;
+      y      = r * y + 1.6666665459E-1f;
+      y      = r * y + 5.0000001201E-1f;
+      return (r * r) * y + r + 1.f;
+    }
+
+  }  // namespace detail
+
+  namespace fast {
+
+    // Max error 1.5 ulp for x in [-87.3, 88.3] (normal results), no handling
+    // of overflow, underflow or NaN
+    template <int W>
+    TSIMD_INLINE vfloatn<W> exp(const vfloatn<W> &p)
+    {
+      vintn<W> n;
+      const auto y = detail::exp_kernel(p, n);
+      return y * detail::pow2(n);
+    }
+
+  }  // namespace fast
 
   template <int W>
-  TSIMD_INLINE vfloatn<W> fast_exp(vfloatn<W> p)
+  TSIMD_INLINE vfloatn<W> fast_exp(const vfloatn<W> &p)
   {
-    auto z = floor(1.44269504088896341f * p + 0.5f);
-    p -= z * 0.693359375f;
-    p -= z * -2.12194440e-4f;
-    auto n = vintn<W>(z);
-
-    z = p * p;
-    z = (((((1.9875691500E-4f  * p + 1.3981999507E-3f) * p +
-            8.3334519073E-3f) * p + 4.1665795894E-2f) * p +
-          1.6666665459E-1f) * p + 5.0000001201E-1f) * z + p + 1.f;
-    p = detail::ldexp(z, n);
-    return p;
+    return fast::exp(p);
   }
 
-#if 0
+  // Max error 1.5 ulp, including subnormal results, overflow and NaN
   template <int W>
   TSIMD_INLINE vfloatn<W> exp(const vfloatn<W> &p)
   {
-    const vfloatn<W> ln2_part1(0.6931457519);
-    const vfloatn<W> ln2_part2(1.4286067653e-6);
-    const vfloatn<W> one_over_ln2(1.44269502162933349609375);
-
-    vfloatn<W> scaled(p * one_over_ln2);
-    auto k_real = floor(scaled);
-    vintn<W> k(k_real);
-
-    // Reduced range version of x
-    auto x = p - k_real * ln2_part1;
-    x -= k_real * ln2_part2;
-
-    // These coefficients are for e^x in [0, ln(2)]
-    const vfloatn<W> one(1.);
-    const vfloatn<W> c2(0.4999999105930328369140625);
-    const vfloatn<W> c3(0.166668415069580078125);
-    const vfloatn<W> c4(4.16539050638675689697265625e-2);
-    const vfloatn<W> c5(8.378830738365650177001953125e-3);
-    const vfloatn<W> c6(1.304379315115511417388916015625e-3);
-    const vfloatn<W> c7(2.7555381529964506626129150390625e-4);
-
-    auto result = x * c7 + c6;
-    result = x * result + c5;
-    result = x * result + c4;
-    result = x * result + c3;
-    result = x * result + c2;
-    result = x * result + one;
-    result = x * result + one;
-
-    // Compute 2^k (should differ for float and double, but I'll avoid
-    // it for now and just do floats)
-    const vintn<W> fpbias(127);
-    auto biased_n = k + fpbias;
-    auto overflow = k > fpbias;
-    // Minimum exponent is -126, so if k is <= -127 (k + 127 <= 0)
-    // we've got underflow. -127 * ln(2) -> -88.02. So the most
-    // negative float input that doesn't result in zero is like -88.
-    auto underflow = (biased_n <= 0);
-    const vintn<W> InfBits(0x7f800000);
-    biased_n <<= 23;
-    // Reinterpret this thing as float
-    vfloatn<W> two_to_the_n = reinterpret_elements_as<float>(biased_n);
-    // Handle both doubles and floats (hopefully eliding the copy for float)
-    auto elemtype_2n = two_to_the_n;
-    result *= elemtype_2n;
-    result = select(overflow, reinterpret_elements_as<float>(InfBits), result);
-    result = select(underflow, 0., result);
-    return result;
+    // e^-104 rounds to 0 and e^89 overflows, which keeps n in [-151, 129]
+    const auto x = min(max(p, vfloatn<W>(-104.f)), vfloatn<W>(89.f));
+
+    vintn<W> n;
+    const auto y = detail::exp_kernel(x, n);
+
+    // Scale by 2^n in two steps so that subnormal results and n = 128
+    // don't need an out of range exponent
+    const auto n1     = n >> 1;
+    const auto result = y * detail::pow2(n1) * detail::pow2(n - n1);
+    return select(p != p, p, result);
   }
-#else
+
+  // Double precision //
+
+  namespace detail {
+
+    // 2^n for n in [-1022, 1023]
+    template <int W>
+    TSIMD_INLINE vdoublen<W> pow2(const vllongn<W> &n)
+    {
+      return reinterpret_elements_as<double>((n + 1023) << 52);
+    }
+
+    // e^(hi + lo) = y * 2^k, where lo is a small correction term to hi
+    // (used by pow() to carry the extra bits of y * log(x))
+    template <int W>
+    TSIMD_INLINE vdoublen<W> exp_kernel(const vdoublen<W> &hi,
+                                        const vdoublen<W> &lo,
+                                        vllongn<W> &k)
+    {
+      // Adding 1.5 * 2^52 rounds to an integer which then sits in the low
+      // bits of the mantissa
+      static const double shifter   = 6755399441055744.0;
+      static const long long kShift = 0x4338000000000000ll;
+
+      static const double log2e = 1.44269504088896338700e+00;
+      static const double ln2Hi = 6.93147180369123816490e-01;
+      static const double ln2Lo = 1.90821492927058770002e-10;
+
+      // Clamp so that k stays in [-1076, 1026], which is past both overflow
+      // and underflow of the result (and of e^x / 2 for sinh() and cosh())
+      const auto x =
+          min(max(hi, vdoublen<W>(-746.0)), vdoublen<W>(711.0));
+
+      const auto t  = x * log2e + shifter;
+      const auto kd = t - shifter;
+      k             = reinterpret_elements_as<long long>(t) - kShift;
+
+      // Cody-Waite reduction: x = k * ln(2) + r, |r| <= ln(2)/2. ln2Hi has
+      // its low 21 bits cleared, so kd * ln2Hi is exact
+      const auto r = ((x - kd * ln2Hi) - kd * ln2Lo) + lo;
+
+      // e^r on [-ln(2)/2, ln(2)/2]: the degree 13 series is within 2^-57
+      // of e^r there, below the rounding error of the evaluation itself
+      static const double c2  = 5.00000000000000000000e-01;
+      static const double c3  = 1.66666666666666657415e-01;
+      static const double c4  = 4.16666666666666643537e-02;
+      static const double c5  = 8.33333333333333321769e-03;
+      static const double c6  = 1.38888888888888894189e-03;
+      static const double c7  = 1.98412698412698412526e-04;
+      static const double c8  = 2.48015873015873015658e-05;
+      static const double c9  = 2.75573192239858925110e-06;
+      static const double c10 = 2.75573192239858882764e-07;
+      static const double c11 = 2.50521083854417202239e-08;
+      static const double c12 = 2.08767569878681001866e-09;
+      static const double c13 = 1.60590438368216133409e-10;
+
+      auto y = r * c13 + c12;
+      y      = r * y + c11;
+      y      = r * y + c10;
+      y      = r * y + c9;
+      y      = r * y + c8;
+      y      = r * y + c7;
+      y      = r * y + c6;
+      y      = r * y + c5;
+      y      = r * y + c4;
+      y      = r * y + c3;
+      y      = r * y + c2;
+      y      = (r * r) * y + r;
+      return y + 1.0;
+    }
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> exp(const vdoublen<W> &hi, const vdoublen<W> &lo)
+    {
+      vllongn<W> k;
+      const auto y = exp_kernel(hi, lo, k);
+
+      // Scale by 2^k in two steps so that subnormal results and k > 1023
+      // don't need an out of range exponent
+      const auto k1 = k >> 1;
+      return y * pow2(k1) * pow2(k - k1);
+    }
+
+  }  // namespace detail
+
   template <int W>
-  TSIMD_INLINE vfloatn<W> exp(const vfloatn<W> &p)
+  TSIMD_INLINE vdoublen<W> exp(const vdoublen<W> &p)
   {
-    return fast_exp(p);
+    const auto result = detail::exp(p, vdoublen<W>(0.0));
+    return select(p != p, p, result);
   }
-#endif
 
-}  // namespace tsimd
\ No newline at end of file
+  namespace fast {
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> exp(const vdoublen<W> &p)
+    {
+      return tsimd::exp(p);
+    }
+
+  }  // namespace fast
+
+  namespace precise {
+
+    // Max error 1 ulp, evaluated in double precision and rounded
+    template <int W>
+    TSIMD_INLINE vfloatn<W> exp(const vfloatn<W> &p)
+    {
+      return vfloatn<W>(tsimd::exp(vdoublen<W>(p)));
+    }
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> exp(const vdoublen<W> &p)
+    {
+      return tsimd::exp(p);
+    }
+
+  }  // namespace precise
+
+}  // namespace tsimd
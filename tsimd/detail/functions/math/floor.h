@@ -38,6 +38,22 @@ namespace tsimd {
     return pack<T, 1>(std::floor(p[0]));
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 floor(const vdouble2 &p)
+  {
+#if defined(__SSE4_1__)
+    return _mm_round_pd(p, _MM_FROUND_TO_NEG_INF);
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = std::floor(p[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 floor(const vfloat4 &p)
@@ -54,6 +70,20 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vdouble4 floor(const vdouble4 &p)
+  {
+#if defined(__AVX__)
+    return _mm256_round_pd(p, _MM_FROUND_TO_NEG_INF);
+#else
+    vdouble4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = std::floor(p[i]);
+
+    return result;
+#endif
+  }
+
   // 8-wide //
 
   TSIMD_INLINE vfloat8 floor(const vfloat8 &p)
@@ -65,6 +95,15 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vdouble8 floor(const vdouble8 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_floor_pd(p);
+#else
+    return vdouble8(floor(vdouble4(p.vl)), floor(vdouble4(p.vh)));
+#endif
+  }
+
   // 16-wide //
 
   TSIMD_INLINE vfloat16 floor(const vfloat16 &p)
@@ -76,4 +115,13 @@ namespace tsimd {
 #endif
   }
 
+  // Composite widths //
+
+  template <typename T, int W, typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> floor(const pack<T, W> &p)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(floor(half_pack(p.vl)), floor(half_pack(p.vh)));
+  }
+
 }  // namespace tsimd
\ No newline at end of file
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <cmath>
+#include <limits>
 
 #include "../../pack.h"
 
@@ -46,125 +47,222 @@ namespace tsimd {
     return result;
   }
 
+  // Single precision //
+
   namespace detail {
-    // Range reduction for logarithms takes log(x) -> log(2^n * y) -> n
-    // * log(2) + log(y) where y is the reduced range (usually in [1/2,
-    // 1)).
+
+    // log(x) = e * log(2) + log(1 + f), 1 + f in [sqrt(2)/2, sqrt(2)), with
+    // the cephes logf polynomial for log(1 + f). x must be positive and
+    // finite, subnormals only when 'subnormals' is set.
     template <int W>
-    TSIMD_INLINE void range_reduce_log(const vfloatn<W> &input,
-                                       vfloatn<W> &reduced,
-                                       vintn<W> &exponent)
+    TSIMD_INLINE vfloatn<W> log_kernel(const vfloatn<W> &p, bool subnormals)
     {
-      auto int_version = reinterpret_elements_as<int>(input);
+      // Scale subnormal inputs up by 2^25 into the normal range
+      auto x    = p;
+      auto bias = vfloatn<W>(8388608.f + 127.f);
+
+      if (subnormals) {
+        const auto subnormal = p < 1.17549435e-38f;
+        x    = select(subnormal, p * 33554432.f, p);
+        bias = select(subnormal, vfloatn<W>(8388608.f + 127.f + 25.f), bias);
+      }
+
+      // Offsetting the bits by 1 - sqrt(2)/2 moves the exponent boundary
+      // to sqrt(2)/2 (ie. for mantissas >= sqrt(2)/2, e is one larger)
+      static const int sqrt1_2 = 0x3f3504f3;
+      static const int one     = 0x3f800000;
 
-      // single precision = SEEE EEEE EMMM MMMM MMMM MMMM MMMM MMMM
-      // exponent mask    = 0111 1111 1000 0000 0000 0000 0000 0000
-      //                    0x7  0xF  0x8  0x0  0x0  0x0  0x0  0x0
-      // non-exponent     = 1000 0000 0111 1111 1111 1111 1111 1111
-      //                  = 0x8  0x0  0x7  0xF  0xF  0xF  0xF  0xF
+      const auto bits = reinterpret_elements_as<int>(x) + (one - sqrt1_2);
 
-      static const int nonexponent_mask = 0x807FFFFF;
+      // Exponent to float: (2^23 + e) has e in the low mantissa bits
+      const auto e =
+          reinterpret_elements_as<float>(srl(bits, 23) | 0x4b000000) - bias;
 
-      // We want the reduced version to have an exponent of -1 which is -1 + 127 after biasing or 126
-      static const int exponent_neg1 = (126l << 23);
-      // NOTE(boulos): We don't need to mask anything out since we know
-      // the sign bit has to be 0. If it's 1, we need to return infinity/nan
-      // anyway (log(x), x = +-0 -> infinity, x < 0 -> NaN).
+      const auto f =
+          reinterpret_elements_as<float>((bits & 0x007fffff) + sqrt1_2) - 1.f;
 
-      //This number is [0, 255] but it means [-127, 128]
-      auto biased_exponent = int_version >> 23;
+      const auto z = f * f;
 
-      // Treat the number as if it were 2^{e+1} * (1.m)/2
-      auto offset_exponent = biased_exponent + 1;
-      exponent = offset_exponent - 127; // get the real value
+      auto y = f * 7.0376836292E-2f - 1.1514610310E-1f;
+      y      = f * y + 1.1676998740E-1f;
+      y      = f * y - 1.2420140846E-1f;
+      y      = f * y + 1.4249322787E-1f;
+      y      = f * y - 1.6668057665E-1f;
+      y      = f * y + 2.0000714765E-1f;
+      y      = f * y - 2.4999993993E-1f;
+      y      = f * y + 3.3333331174E-1f;
+      y *= f * z;
 
-      // Blend the offset_exponent with the original input (do this in
-      // int for now, until I decide if float can have & and &not)
-      auto blended = (int_version & nonexponent_mask) | (exponent_neg1);
-      reduced = reinterpret_elements_as<float>(blended);
+      // log(2) is split in two, ln2Hi having 9 significant bits so e * ln2Hi
+      // is exact
+      y += e * -2.12194440e-4f;
+      y -= 0.5f * z;
+      return (f + y) + e * 0.693359375f;
     }
 
-  } // namespace detail
+  }  // namespace detail
 
-#if 0 //TODO: convert this ispc version to tsimd
+  namespace fast {
+
+    // Max error 1 ulp for positive normal x, no handling of subnormals, 0,
+    // negative values, infinity or NaN
+    template <int W>
+    TSIMD_INLINE vfloatn<W> log(const vfloatn<W> &p)
+    {
+      return detail::log_kernel(p, false);
+    }
+
+  }  // namespace fast
+
+  // Max error 1 ulp, including subnormals and special values
   template <int W>
-  TSIMD_INLINE vfloatn<W> fast_log(const vfloatn<W> &p)
+  TSIMD_INLINE vfloatn<W> log(const vfloatn<W> &p)
   {
-    int e;
-    p = frexp(p, &e);
-
-    int x_smaller_SQRTHF = (0.707106781186547524f > p) ? 0xffffffff : 0;
-    e += x_smaller_SQRTHF;
-    int ix_add = intbits(p);
-    ix_add &= x_smaller_SQRTHF;
-    p += floatbits(ix_add) - 1.f;
-
-    float z = p * p;
-    float y =
-        ((((((((7.0376836292E-2f * p
-                + -1.1514610310E-1f) * p
-               + 1.1676998740E-1f) * p
-              + -1.2420140846E-1f) * p
-             + 1.4249322787E-1f) * p
-            + -1.6668057665E-1f) * p
-           + 2.0000714765E-1f) * p
-          + -2.4999993993E-1f) * p
-         + 3.3333331174E-1f) * p * z;
-
-    float fe = (float)e;
-    y += fe * -2.12194440e-4;
-    y -= 0.5f * z;
-    z  = p + y;
-    return z + 0.693359375 * fe;
+    const auto result = detail::log_kernel(p, true);
+
+    const vfloatn<W> inf(std::numeric_limits<float>::infinity());
+    const vfloatn<W> nan(std::numeric_limits<float>::quiet_NaN());
+
+    auto special = select(p == inf, inf, result);
+    special      = select(p == 0.f, -inf, special);
+    return select(p < 0.f | p != p, nan, special);
   }
-#endif
+
+  // Double precision //
+
+  namespace detail {
+
+    // Splits x into k and f with x = 2^k * (1 + f), 1 + f in
+    // [sqrt(2)/2, sqrt(2)), and evaluates the log(1 + f) kernel
+    // (fdlibm/musl): log(1 + f) = f - hfsq + s * (hfsq + R), where
+    // s = f / (2 + f), hfsq = f^2 / 2 and R is a minimax polynomial in s^2
+    template <int W>
+    TSIMD_INLINE void log_kernel(const vdoublen<W> &p,
+                                 vdoublen<W> &kd,
+                                 vdoublen<W> &f,
+                                 vdoublen<W> &hfsq,
+                                 vdoublen<W> &sR)
+    {
+      // Scale subnormal inputs up by 2^54 into the normal range
+      const auto subnormal = p < 2.2250738585072014e-308;
+      const auto x         = select(subnormal, p * 18014398509481984.0, p);
+
+      // Offsetting the bits by 1 - sqrt(2)/2 moves the exponent boundary
+      // to sqrt(2)/2 (ie. for mantissas >= sqrt(2)/2, k is one larger)
+      static const long long sqrt1_2 = 0x3fe6a09e667f3bcdll;
+      static const long long one     = 0x3ff0000000000000ll;
+
+      const auto bits = reinterpret_elements_as<long long>(x) + (one - sqrt1_2);
+
+      // Exponent to double: (2^52 + e) has e in the low mantissa bits
+      static const long long twoTo52 = 0x4330000000000000ll;
+      const auto e =
+          reinterpret_elements_as<double>(srl(bits, 52) | twoTo52);
+      kd = e - select(subnormal,
+                      vdoublen<W>(4503599627370496.0 + 1023 + 54),
+                      vdoublen<W>(4503599627370496.0 + 1023));
+
+      const auto m = reinterpret_elements_as<double>(
+          (bits & 0x000fffffffffffffll) + sqrt1_2);
+      f = m - 1.0;
+
+      static const double Lg1 = 6.666666666666735130e-01;
+      static const double Lg2 = 3.999999999940941908e-01;
+      static const double Lg3 = 2.857142874366239149e-01;
+      static const double Lg4 = 2.222219843214978396e-01;
+      static const double Lg5 = 1.818357216161805012e-01;
+      static const double Lg6 = 1.531383769920937332e-01;
+      static const double Lg7 = 1.479819860511658591e-01;
+
+      hfsq         = 0.5 * f * f;
+      const auto s = f / (2.0 + f);
+      const auto z = s * s;
+      const auto w = z * z;
+
+      const auto t1 = w * (Lg2 + w * (Lg4 + w * Lg6));
+      const auto t2 = z * (Lg1 + w * (Lg3 + w * (Lg5 + w * Lg7)));
+
+      sR = s * (hfsq + t1 + t2);
+    }
+
+    // log(x) as an unevaluated sum hi + lo, carrying ~20 extra bits for pow()
+    template <int W>
+    TSIMD_INLINE void log(const vdoublen<W> &p,
+                          vdoublen<W> &hi,
+                          vdoublen<W> &lo)
+    {
+      static const double ln2Hi = 6.93147180369123816490e-01;
+      static const double ln2Lo = 1.90821492927058770002e-10;
+
+      vdoublen<W> kd, f, hfsq, sR;
+      log_kernel(p, kd, f, hfsq, sR);
+
+      // Clear the low 32 bits of f - hfsq so f - h is exact
+      auto h = reinterpret_elements_as<long long>(f - hfsq);
+      h &= 0xffffffff00000000ll;
+      const auto fh = reinterpret_elements_as<double>(h);
+      const auto fl = (f - fh) - hfsq + sR;
+
+      // kd * ln2Hi is exact, add it to fh with an error free two-sum
+      const auto a  = kd * ln2Hi;
+      hi            = a + fh;
+      const auto bb = hi - a;
+      const auto err = (a - (hi - bb)) + (fh - bb);
+
+      const auto l = err + fl + kd * ln2Lo;
+
+      // Renormalize so |lo| <= ulp(hi) / 2
+      const auto sum = hi + l;
+      lo             = l - (sum - hi);
+      hi             = sum;
+    }
+
+  }  // namespace detail
 
   template <int W>
-  TSIMD_INLINE vfloatn<W> log(const vfloatn<W> &p)
+  TSIMD_INLINE vdoublen<W> log(const vdoublen<W> &p)
   {
-    const vintn<W> NaN_bits(0x7fc00000);
-    const vintn<W> Neg_Inf_bits(0xFF800000);
-    const auto NaN = reinterpret_elements_as<float>(NaN_bits);
-    const auto neg_inf = reinterpret_elements_as<float>(Neg_Inf_bits);
-    auto use_nan = p < 0;
-    auto use_inf = p == 0;
-    auto exceptional = use_nan | use_inf;
-    const vfloatn<W> one(1.0);
-
-    auto patched = select(exceptional, one, p);
-
-    vfloatn<W> reduced;
-    vintn<W> exponent;
-    detail::range_reduce_log(patched, reduced, exponent);
-
-    const auto ln2 = 0.693147182464599609375;
-
-    auto x1 = one - reduced;
-    const auto c1 = 0.50000095367431640625;
-    const auto c2 = 0.33326041698455810546875;
-    const auto c3 = 0.2519190013408660888671875;
-    const auto c4 = 0.17541764676570892333984375;
-    const auto c5 = 0.3424419462680816650390625;
-    const auto c6 = -0.599632322788238525390625;
-    const auto c7 = +1.98442304134368896484375;
-    const auto c8 = -2.4899270534515380859375;
-    const auto c9 = +1.7491014003753662109375;
-
-    auto result = x1 * c9 + c8;
-    result = x1 * result + c7;
-    result = x1 * result + c6;
-    result = x1 * result + c5;
-    result = x1 * result + c4;
-    result = x1 * result + c3;
-    result = x1 * result + c2;
-    result = x1 * result + c1;
-    result = x1 * result + one;
-
-    // Equation was for -(ln(red)/(1-red))
-    result *= -x1;
-    result += vfloatn<W>(exponent) * ln2;
-
-    return select(exceptional, select(use_nan, NaN, neg_inf), result);
+    static const double ln2Hi = 6.93147180369123816490e-01;
+    static const double ln2Lo = 1.90821492927058770002e-10;
+
+    vdoublen<W> kd, f, hfsq, sR;
+    detail::log_kernel(p, kd, f, hfsq, sR);
+
+    const auto result = sR + kd * ln2Lo - hfsq + f + kd * ln2Hi;
+
+    const vdoublen<W> inf(std::numeric_limits<double>::infinity());
+    const vdoublen<W> nan(std::numeric_limits<double>::quiet_NaN());
+
+    auto special = select(p == inf, inf, result);
+    special      = select(p == 0.0, -inf, special);
+    return select(p < 0.0 | p != p, nan, special);
   }
 
-}  // namespace tsimd
\ No newline at end of file
+  namespace fast {
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> log(const vdoublen<W> &p)
+    {
+      return tsimd::log(p);
+    }
+
+  }  // namespace fast
+
+  namespace precise {
+
+    // Max error 1 ulp, evaluated in double precision and rounded
+    template <int W>
+    TSIMD_INLINE vfloatn<W> log(const vfloatn<W> &p)
+    {
+      return vfloatn<W>(tsimd::log(vdoublen<W>(p)));
+    }
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> log(const vdoublen<W> &p)
+    {
+      return tsimd::log(p);
+    }
+
+  }  // namespace precise
+
+}  // namespace tsimd
@@ -38,6 +38,38 @@ namespace tsimd {
     return pack<T, 1>(std::min(p1[0], p2[0]));
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 min(const vdouble2 &p1, const vdouble2 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_min_pd(p1, p2);
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong2 min(const vllong2 &p1, const vllong2 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm_min_epi64(p1, p2);
+#elif defined(__SSE4_2__)
+    return _mm_blendv_epi8(p1, p2, _mm_cmpgt_epi64(p1, p2));
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 min(const vfloat4 &p1, const vfloat4 &p2)
@@ -68,6 +100,54 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint4 min(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_min_epu32(p1, p2);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 min(const vdouble4 &p1, const vdouble4 &p2)
+  {
+#if defined(__AVX__)
+    return _mm256_min_pd(p1, p2);
+#else
+    vdouble4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong4 min(const vllong4 &p1, const vllong4 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_min_epi64(p1, p2);
+#elif defined(__AVX2__)
+    return _mm256_blendv_epi8(p1, p2, _mm256_cmpgt_epi64(p1, p2));
+#elif defined(__AVX__)
+    return vllong4(
+        _mm_blendv_epi8(p1.vl, p2.vl, _mm_cmpgt_epi64(p1.vl, p2.vl)),
+        _mm_blendv_epi8(p1.vh, p2.vh, _mm_cmpgt_epi64(p1.vh, p2.vh)));
+#else
+    vllong4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
   // 8-wide //
 
   TSIMD_INLINE vfloat8 min(const vfloat8 &p1, const vfloat8 &p2)
@@ -92,6 +172,66 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint8 min(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epu32(p1, p2);
+#elif defined(__AVX__)
+    return vuint8(_mm_min_epu32(p1.vl, p2.vl), _mm_min_epu32(p1.vh, p2.vh));
+#else
+    return vuint8(min(vuint4(p1.vl), vuint4(p2.vl)),
+                  min(vuint4(p1.vh), vuint4(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vdouble8 min(const vdouble8 &p1, const vdouble8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_min_pd(p1, p2);
+#else
+    return vdouble8(min(vdouble4(p1.vl), vdouble4(p2.vl)),
+                    min(vdouble4(p1.vh), vdouble4(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 min(const vllong8 &p1, const vllong8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_min_epi64(p1, p2);
+#else
+    return vllong8(min(vllong4(p1.vl), vllong4(p2.vl)),
+                   min(vllong4(p1.vh), vllong4(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort8 min(const vshort8 &p1, const vshort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_min_epi16(p1, p2);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 min(const vushort8 &p1, const vushort8 &p2)
+  {
+#if defined(__SSE4_1__)
+    return _mm_min_epu16(p1, p2);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
   // 16-wide //
 
   TSIMD_INLINE vfloat16 min(const vfloat16 &p1, const vfloat16 &p2)
@@ -114,4 +254,136 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint16 min(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_min_epu32(p1, p2);
+#else
+    return vuint16(min(vuint8(p1.vl), vuint8(p2.vl)),
+                   min(vuint8(p1.vh), vuint8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vschar16 min(const vschar16 &p1, const vschar16 &p2)
+  {
+#if defined(__SSE4_1__)
+    return _mm_min_epi8(p1, p2);
+#else
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuchar16 min(const vuchar16 &p1, const vuchar16 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_min_epu8(p1, p2);
+#else
+    vuchar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort16 min(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epi16(p1, p2);
+#else
+    return vshort16(min(vshort8(p1.vl), vshort8(p2.vl)),
+                    min(vshort8(p1.vh), vshort8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 min(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epu16(p1, p2);
+#else
+    return vushort16(min(vushort8(p1.vl), vushort8(p2.vl)),
+                     min(vushort8(p1.vh), vushort8(p2.vh)));
+#endif
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE vschar32 min(const vschar32 &p1, const vschar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epi8(p1, p2);
+#else
+    return vschar32(min(vschar16(p1.vl), vschar16(p2.vl)),
+                    min(vschar16(p1.vh), vschar16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 min(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epu8(p1, p2);
+#else
+    return vuchar32(min(vuchar16(p1.vl), vuchar16(p2.vl)),
+                    min(vuchar16(p1.vh), vuchar16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 min(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_min_epi16(p1, p2);
+#else
+    return vshort32(min(vshort16(p1.vl), vshort16(p2.vl)),
+                    min(vshort16(p1.vh), vshort16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 min(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_min_epu16(p1, p2);
+#else
+    return vushort32(min(vushort16(p1.vl), vushort16(p2.vl)),
+                     min(vushort16(p1.vh), vushort16(p2.vh)));
+#endif
+  }
+
+  // 64-wide //
+
+  TSIMD_INLINE vschar64 min(const vschar64 &p1, const vschar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_min_epi8(p1, p2);
+#else
+    return vschar64(min(vschar32(p1.vl), vschar32(p2.vl)),
+                    min(vschar32(p1.vh), vschar32(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 min(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_min_epu8(p1, p2);
+#else
+    return vuchar64(min(vuchar32(p1.vl), vuchar32(p2.vl)),
+                    min(vuchar32(p1.vh), vuchar32(p2.vh)));
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename T, int W, typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> min(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(min(half_pack(p1.vl), half_pack(p2.vl)),
+                      min(half_pack(p1.vh), half_pack(p2.vh)));
+  }
+
 }  // namespace tsimd
\ No newline at end of file
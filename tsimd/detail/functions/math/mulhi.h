@@ -0,0 +1,231 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "../../pack.h"
+
+namespace tsimd {
+
+  // 1-wide //
+
+  template <typename T,
+            typename = traits::enable_if_t<std::is_integral<T>::value &&
+                                           (sizeof(T) == 2 || sizeof(T) == 4)>>
+  TSIMD_INLINE pack<T, 1> mulhi(const pack<T, 1> &p1, const pack<T, 1> &p2)
+  {
+    using wide_t = typename std::
+        conditional<std::is_signed<T>::value, int64_t, uint64_t>::type;
+    return pack<T, 1>(T((wide_t(p1[0]) * wide_t(p2[0])) >> (8 * sizeof(T))));
+  }
+
+  namespace detail {
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> mulhi32(const pack<T, W> &p1, const pack<T, W> &p2)
+    {
+      pack<T, W> result;
+
+      for (int i = 0; i < W; ++i)
+        result[i] = mulhi(pack<T, 1>(p1[i]), pack<T, 1>(p2[i]))[0];
+
+      return result;
+    }
+
+  }  // namespace detail
+
+  // 4-wide //
+
+  // NOTE: mul_epi32/mul_epu32 multiply the even 32-bit lanes into 64-bit
+  //       products, so odd lanes are shifted down and the high halves of
+  //       both products get blended back together
+
+  TSIMD_INLINE vint4 mulhi(const vint4 &p1, const vint4 &p2)
+  {
+#if defined(__SSE4_1__)
+    const __m128i even = _mm_mul_epi32(p1, p2);
+    const __m128i odd =
+        _mm_mul_epi32(_mm_srli_epi64(p1, 32), _mm_srli_epi64(p2, 32));
+    return _mm_blend_epi16(_mm_srli_epi64(even, 32), odd, 0xcc);
+#else
+    return detail::mulhi32(p1, p2);
+#endif
+  }
+
+  TSIMD_INLINE vuint4 mulhi(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__SSE4_1__)
+    const __m128i even = _mm_mul_epu32(p1, p2);
+    const __m128i odd =
+        _mm_mul_epu32(_mm_srli_epi64(p1, 32), _mm_srli_epi64(p2, 32));
+    return _mm_blend_epi16(_mm_srli_epi64(even, 32), odd, 0xcc);
+#else
+    return detail::mulhi32(p1, p2);
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vshort8 mulhi(const vshort8 &p1, const vshort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_mulhi_epi16(p1, p2);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = (int64_t(p1[i]) * int64_t(p2[i])) >> 16;
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 mulhi(const vushort8 &p1, const vushort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_mulhi_epu16(p1, p2);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = (int64_t(p1[i]) * int64_t(p2[i])) >> 16;
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vint8 mulhi(const vint8 &p1, const vint8 &p2)
+  {
+#if defined(__AVX2__)
+    const __m256i even = _mm256_mul_epi32(p1, p2);
+    const __m256i odd =
+        _mm256_mul_epi32(_mm256_srli_epi64(p1, 32), _mm256_srli_epi64(p2, 32));
+    return _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xaa);
+#else
+    return vint8(mulhi(vint4(p1.vl), vint4(p2.vl)),
+                 mulhi(vint4(p1.vh), vint4(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuint8 mulhi(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX2__)
+    const __m256i even = _mm256_mul_epu32(p1, p2);
+    const __m256i odd =
+        _mm256_mul_epu32(_mm256_srli_epi64(p1, 32), _mm256_srli_epi64(p2, 32));
+    return _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xaa);
+#else
+    return vuint8(mulhi(vuint4(p1.vl), vuint4(p2.vl)),
+                  mulhi(vuint4(p1.vh), vuint4(p2.vh)));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vint16 mulhi(const vint16 &p1, const vint16 &p2)
+  {
+#if defined(__AVX512F__)
+    const __m512i even = _mm512_mul_epi32(p1, p2);
+    const __m512i odd =
+        _mm512_mul_epi32(_mm512_srli_epi64(p1, 32), _mm512_srli_epi64(p2, 32));
+    return _mm512_mask_blend_epi32(0xaaaa, _mm512_srli_epi64(even, 32), odd);
+#else
+    return vint16(mulhi(vint8(p1.vl), vint8(p2.vl)),
+                  mulhi(vint8(p1.vh), vint8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuint16 mulhi(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    const __m512i even = _mm512_mul_epu32(p1, p2);
+    const __m512i odd =
+        _mm512_mul_epu32(_mm512_srli_epi64(p1, 32), _mm512_srli_epi64(p2, 32));
+    return _mm512_mask_blend_epi32(0xaaaa, _mm512_srli_epi64(even, 32), odd);
+#else
+    return vuint16(mulhi(vuint8(p1.vl), vuint8(p2.vl)),
+                   mulhi(vuint8(p1.vh), vuint8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 mulhi(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_mulhi_epi16(p1, p2);
+#else
+    return vshort16(mulhi(vshort8(p1.vl), vshort8(p2.vl)),
+                    mulhi(vshort8(p1.vh), vshort8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 mulhi(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_mulhi_epu16(p1, p2);
+#else
+    return vushort16(mulhi(vushort8(p1.vl), vushort8(p2.vl)),
+                     mulhi(vushort8(p1.vh), vushort8(p2.vh)));
+#endif
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE vshort32 mulhi(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mulhi_epi16(p1, p2);
+#else
+    return vshort32(mulhi(vshort16(p1.vl), vshort16(p2.vl)),
+                    mulhi(vshort16(p1.vh), vshort16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 mulhi(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mulhi_epu16(p1, p2);
+#else
+    return vushort32(mulhi(vushort16(p1.vl), vushort16(p2.vl)),
+                     mulhi(vushort16(p1.vh), vushort16(p2.vh)));
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename T,
+            int W,
+            typename = traits::enable_if_t<std::is_integral<T>::value &&
+                                           (sizeof(T) == 2 || sizeof(T) == 4)>,
+            typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> mulhi(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(mulhi(half_pack(p1.vl), half_pack(p2.vl)),
+                      mulhi(half_pack(p1.vh), half_pack(p2.vh)));
+  }
+
+}  // namespace tsimd
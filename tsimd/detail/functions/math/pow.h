@@ -24,17 +24,150 @@
 
 #pragma once
 
+#include <limits>
+
 #include "../../pack.h"
 
+#include "../algorithm/select.h"
+
+#include "abs.h"
 #include "exp.h"
+#include "floor.h"
 #include "log.h"
 
 namespace tsimd {
 
   template <typename T, int W, typename = traits::is_floating_point_t<T>>
-  TSIMD_INLINE pack<T, W> pow(const pack<T, W> &v, const float b)
+  TSIMD_INLINE pack<T, W> pow(const pack<T, W> &v, const pack<T, W> &b)
   {
     return exp(b * log(v));
   }
 
-}  // namespace tsimd
\ No newline at end of file
+  template <typename T, int W, typename = traits::is_floating_point_t<T>>
+  TSIMD_INLINE pack<T, W> pow(const pack<T, W> &v,
+                              const typename pack<T, W>::value_t b)
+  {
+    return pow(v, pack<T, W>(b));
+  }
+
+  // Double precision //
+
+  namespace detail {
+
+    // Splits a into two 26-bit halves so their products are exact (Veltkamp)
+    template <int W>
+    TSIMD_INLINE void split(const vdoublen<W> &a,
+                            vdoublen<W> &hi,
+                            vdoublen<W> &lo)
+    {
+      const auto c = 134217729.0 * a;  // 2^27 + 1
+      hi           = c - (c - a);
+      lo           = a - hi;
+    }
+
+  }  // namespace detail
+
+  // NOTE: x^y = e^(y * log(x)) loses |y * log(x)| ulps when done in double,
+  //       so log(x) and its product with y are carried as double-double
+  //       and the low part is folded into exp()'s reduced argument
+
+  template <int W>
+  TSIMD_INLINE vdoublen<W> pow(const vdoublen<W> &x, const vdoublen<W> &y)
+  {
+    const vdoublen<W> inf(std::numeric_limits<double>::infinity());
+    const vdoublen<W> nan(std::numeric_limits<double>::quiet_NaN());
+
+    const auto ax = abs(x);
+
+    vdoublen<W> lhi, llo;
+    detail::log(ax, lhi, llo);
+
+    // y * (lhi + llo) with Dekker's exact product for y * lhi
+    vdoublen<W> yh, yl, lh, ll;
+    detail::split(y, yh, yl);
+    detail::split(lhi, lh, ll);
+
+    // NOTE: llo is within half an ulp of lhi, so pl stays small enough to
+    //       be added to exp()'s reduced argument without renormalizing
+    const auto ph = y * lhi;
+    auto pl = (((yh * lh - ph) + yh * ll) + yl * lh) + yl * ll + y * llo;
+
+    // When exp() saturates, the split may have overflowed and pl doesn't
+    // matter anyway
+    pl = select(abs(ph) < 1024.0, pl, vdoublen<W>(0.0));
+
+    auto result = detail::exp(ph, pl);
+
+    // IEEE special cases
+    const auto yIsInt = floor(y) == y;
+    const auto yIsOdd = yIsInt & (floor(y * 0.5) != y * 0.5);
+
+    result = select(ax == 0.0, select(y < 0.0, inf, 0.0), result);
+    result = select(ax == inf, select(y < 0.0, 0.0, inf), result);
+    result = select((ax == 1.0) & (abs(y) == inf), 1.0, result);
+
+    // Negative x (including -0) flips the sign for odd integer y
+    const auto signBit =
+        reinterpret_elements_as<long long>(x) & (1ll << 63);
+    const auto negated = reinterpret_elements_as<double>(
+        reinterpret_elements_as<long long>(result) | signBit);
+    result = select(yIsOdd, negated, result);
+
+    result = select((x < 0.0) & (x != -inf) & !yIsInt, nan, result);
+    result = select(x != x | y != y, x + y, result);
+    return select(x == 1.0 | y == 0.0, 1.0, result);
+  }
+
+  // Single precision //
+
+  // Max error 1 ulp, evaluated in double precision and rounded
+  template <int W>
+  TSIMD_INLINE vfloatn<W> pow(const vfloatn<W> &x, const vfloatn<W> &y)
+  {
+    return vfloatn<W>(pow(vdoublen<W>(x), vdoublen<W>(y)));
+  }
+
+  namespace fast {
+
+    // e^(y * log(x)) with the fast exp() and log(), max error
+    // 1 + 1.5 * |y * log(x)| ulp for normal x > 0 and normal results, no
+    // handling of other values
+    template <int W>
+    TSIMD_INLINE vfloatn<W> pow(const vfloatn<W> &x, const vfloatn<W> &y)
+    {
+      return fast::exp(y * fast::log(x));
+    }
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> pow(const vdoublen<W> &x, const vdoublen<W> &y)
+    {
+      return tsimd::pow(x, y);
+    }
+
+    template <typename T, int W, typename = traits::is_floating_point_t<T>>
+    TSIMD_INLINE pack<T, W> pow(const pack<T, W> &v,
+                                const typename pack<T, W>::value_t b)
+    {
+      return fast::pow(v, pack<T, W>(b));
+    }
+
+  }  // namespace fast
+
+  namespace precise {
+
+    template <typename T, int W, typename = traits::is_floating_point_t<T>>
+    TSIMD_INLINE pack<T, W> pow(const pack<T, W> &v, const pack<T, W> &b)
+    {
+      return tsimd::pow(v, b);
+    }
+
+    template <typename T, int W, typename = traits::is_floating_point_t<T>>
+    TSIMD_INLINE pack<T, W> pow(const pack<T, W> &v,
+                                const typename pack<T, W>::value_t b)
+    {
+      return tsimd::pow(v, pack<T, W>(b));
+    }
+
+  }  // namespace precise
+
+}  // namespace tsimd
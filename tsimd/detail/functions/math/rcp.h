@@ -0,0 +1,210 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+
+namespace tsimd {
+
+  template <typename T, int W, typename = traits::is_floating_point_t<T>>
+  TSIMD_INLINE pack<T, W> rcp(const pack<T, W> &p)
+  {
+    return pack<T, W>(T(1)) / p;
+  }
+
+  namespace detail {
+
+    // Hardware reciprocal estimates, relative error <= 1.5 * 2^-12 (2^-14
+    // with AVX-512)
+
+    // 1-wide //
+
+    TSIMD_INLINE vfloat1 rcp_estimate(const vfloat1 &p)
+    {
+      return vfloat1(1.f / p[0]);
+    }
+
+    // 4-wide //
+
+    TSIMD_INLINE vfloat4 rcp_estimate(const vfloat4 &p)
+    {
+#if defined(__AVX512VL__)
+      return _mm_rcp14_ps(p);
+#elif defined(__SSE__)
+      return _mm_rcp_ps(p);
+#else
+      vfloat4 result;
+
+      for (int i = 0; i < 4; ++i)
+        result[i] = 1.f / p[i];
+
+      return result;
+#endif
+    }
+
+    // 8-wide //
+
+    TSIMD_INLINE vfloat8 rcp_estimate(const vfloat8 &p)
+    {
+#if defined(__AVX512VL__)
+      return _mm256_rcp14_ps(p);
+#elif defined(__AVX2__) || defined(__AVX__)
+      return _mm256_rcp_ps(p);
+#else
+      return vfloat8(rcp_estimate(vfloat4(p.vl)), rcp_estimate(vfloat4(p.vh)));
+#endif
+    }
+
+    // 16-wide //
+
+    TSIMD_INLINE vfloat16 rcp_estimate(const vfloat16 &p)
+    {
+#if defined(__AVX512F__)
+      return _mm512_rcp14_ps(p);
+#else
+      return vfloat16(rcp_estimate(vfloat8(p.vl)),
+                      rcp_estimate(vfloat8(p.vh)));
+#endif
+    }
+
+    // Composite widths //
+
+    template <int W, typename = traits::has_halves_t<W>>
+    TSIMD_INLINE vfloatn<W> rcp_estimate(const vfloatn<W> &p)
+    {
+      using half_pack = vfloatn<W / 2>;
+      return vfloatn<W>(rcp_estimate(half_pack(p.vl)),
+                        rcp_estimate(half_pack(p.vh)));
+    }
+
+    // One Newton-Raphson step refining r ~= 1/x, r + r * (1 - x * r), fused
+    // where FMA is available
+    template <int W>
+    TSIMD_INLINE vfloatn<W> rcp_step(const vfloatn<W> &p, const vfloatn<W> &r)
+    {
+      return r + r * (1.f - p * r);
+    }
+
+#if defined(__FMA__)
+    TSIMD_INLINE vfloat4 rcp_step(const vfloat4 &p, const vfloat4 &r)
+    {
+      return _mm_fmadd_ps(r, _mm_fnmadd_ps(p, r, vfloat4(1.f)), r);
+    }
+
+    TSIMD_INLINE vfloat8 rcp_step(const vfloat8 &p, const vfloat8 &r)
+    {
+      return _mm256_fmadd_ps(r, _mm256_fnmadd_ps(p, r, vfloat8(1.f)), r);
+    }
+#endif
+
+#if defined(__AVX512F__)
+    TSIMD_INLINE vfloat16 rcp_step(const vfloat16 &p, const vfloat16 &r)
+    {
+      return _mm512_fmadd_ps(r, _mm512_fnmadd_ps(p, r, vfloat16(1.f)), r);
+    }
+#elif defined(__FMA__)
+    TSIMD_INLINE vfloat16 rcp_step(const vfloat16 &p, const vfloat16 &r)
+    {
+      return vfloat16(rcp_step(vfloat8(p.vl), vfloat8(r.vl)),
+                      rcp_step(vfloat8(p.vh), vfloat8(r.vh)));
+    }
+#endif
+
+  }  // namespace detail
+
+  // 1/x as the hardware estimate refined by N (0, 1 or 2) Newton-Raphson
+  // steps. Max error for normal |x| < 2^126:
+  //
+  //   N = 0   relative error 1.5 * 2^-12 (2^-14 with AVX-512)
+  //   N = 1   3 ulp
+  //   N = 2   1.5 ulp (0.5 ulp with FMA)
+  //
+  // Only N = 0 handles 0 and infinity, refined steps give NaN for them.
+  template <int N, int W>
+  TSIMD_INLINE vfloatn<W> rcp(const vfloatn<W> &p)
+  {
+    static_assert(N >= 0 && N <= 2, "rcp<N>() takes 0, 1 or 2 steps");
+
+    auto r = detail::rcp_estimate(p);
+
+    for (int i = 0; i < N; ++i)
+      r = detail::rcp_step(p, r);
+
+    return r;
+  }
+
+  // There are no double precision estimates outside of AVX-512, these are
+  // exact
+  template <int N, int W>
+  TSIMD_INLINE vdoublen<W> rcp(const vdoublen<W> &p)
+  {
+    return tsimd::rcp(p);
+  }
+
+  // a / b as a * rcp<N>(b), with N defaulting to 1 refinement step. Max
+  // error 3.5 ulp for N = 1 and 2 ulp for N = 2, for normal |b| < 2^126 and
+  // a normal quotient.
+  template <int N = 1, int W>
+  TSIMD_INLINE vfloatn<W> fast_div(const vfloatn<W> &a, const vfloatn<W> &b)
+  {
+    return a * rcp<N>(b);
+  }
+
+  template <int N = 1, int W>
+  TSIMD_INLINE vdoublen<W> fast_div(const vdoublen<W> &a,
+                                    const vdoublen<W> &b)
+  {
+    return a / b;
+  }
+
+  namespace fast {
+
+    // rcp<1>(), max error 3 ulp for |x| in [2^-126, 2^126). 0 and infinity
+    // give NaN.
+    template <int W>
+    TSIMD_INLINE vfloatn<W> rcp(const vfloatn<W> &p)
+    {
+      return tsimd::rcp<1>(p);
+    }
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> rcp(const vdoublen<W> &p)
+    {
+      return tsimd::rcp(p);
+    }
+
+  }  // namespace fast
+
+  namespace precise {
+
+    template <typename T, int W, typename = traits::is_floating_point_t<T>>
+    TSIMD_INLINE pack<T, W> rcp(const pack<T, W> &p)
+    {
+      return tsimd::rcp(p);
+    }
+
+  }  // namespace precise
+
+}  // namespace tsimd
@@ -0,0 +1,102 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "sqrt.h"
+
+namespace tsimd {
+
+  namespace detail {
+
+    // One Newton-Raphson step refining r ~= 1/sqrt(x),
+    // r + r/2 * (1 - x * r^2), fused where FMA is available
+    template <int W>
+    TSIMD_INLINE vfloatn<W> rsqrt_step(const vfloatn<W> &p,
+                                       const vfloatn<W> &r)
+    {
+      return r + (0.5f * r) * (1.f - (p * r) * r);
+    }
+
+#if defined(__FMA__)
+    TSIMD_INLINE vfloat4 rsqrt_step(const vfloat4 &p, const vfloat4 &r)
+    {
+      const __m128 e = _mm_fnmadd_ps(_mm_mul_ps(p, r), r, vfloat4(1.f));
+      return _mm_fmadd_ps(_mm_mul_ps(r, vfloat4(0.5f)), e, r);
+    }
+
+    TSIMD_INLINE vfloat8 rsqrt_step(const vfloat8 &p, const vfloat8 &r)
+    {
+      const __m256 e = _mm256_fnmadd_ps(_mm256_mul_ps(p, r), r, vfloat8(1.f));
+      return _mm256_fmadd_ps(_mm256_mul_ps(r, vfloat8(0.5f)), e, r);
+    }
+#endif
+
+#if defined(__AVX512F__)
+    TSIMD_INLINE vfloat16 rsqrt_step(const vfloat16 &p, const vfloat16 &r)
+    {
+      const __m512 e =
+          _mm512_fnmadd_ps(_mm512_mul_ps(p, r), r, vfloat16(1.f));
+      return _mm512_fmadd_ps(_mm512_mul_ps(r, vfloat16(0.5f)), e, r);
+    }
+#elif defined(__FMA__)
+    TSIMD_INLINE vfloat16 rsqrt_step(const vfloat16 &p, const vfloat16 &r)
+    {
+      return vfloat16(rsqrt_step(vfloat8(p.vl), vfloat8(r.vl)),
+                      rsqrt_step(vfloat8(p.vh), vfloat8(r.vh)));
+    }
+#endif
+
+  }  // namespace detail
+
+  // 1/sqrt(x) as the hardware estimate refined by N (0, 1 or 2)
+  // Newton-Raphson steps. Max error for normal x > 0:
+  //
+  //   N = 0   relative error 1.5 * 2^-12 (2^-14 with AVX-512)
+  //   N = 1   3.5 ulp
+  //   N = 2   1.5 ulp (1 ulp with FMA)
+  //
+  // Only N = 0 handles 0 and infinity, refined steps give NaN for them.
+  template <int N, int W>
+  TSIMD_INLINE vfloatn<W> rsqrt(const vfloatn<W> &p)
+  {
+    static_assert(N >= 0 && N <= 2, "rsqrt<N>() takes 0, 1 or 2 steps");
+
+    auto r = detail::rsqrt_estimate(p);
+
+    for (int i = 0; i < N; ++i)
+      r = detail::rsqrt_step(p, r);
+
+    return r;
+  }
+
+  // There are no double precision estimates outside of AVX-512, these are
+  // exact
+  template <int N, int W>
+  TSIMD_INLINE vdoublen<W> rsqrt(const vdoublen<W> &p)
+  {
+    return vdoublen<W>(1.0) / sqrt(p);
+  }
+
+}  // namespace tsimd
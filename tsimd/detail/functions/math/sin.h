@@ -30,7 +30,7 @@
 
 #include "../algorithm/select.h"
 
-#include "floor.h"
+#include "trig_reduce.h"
 
 namespace tsimd {
 
@@ -48,56 +48,168 @@ namespace tsimd {
     return result;
   }
 
-  // Transcendental functions from "ispc": https://github.com/ispc/ispc/
-  // Most of the transcendental implementations in ispc code come from
-  // Solomon Boulos's "syrah": https://github.com/boulos/syrah/
+  // Single precision //
+
+  namespace detail {
+
+    // cephes sinf/cosf polynomials on [-pi/4, pi/4]
+
+    template <int W>
+    TSIMD_INLINE vfloatn<W> sin_kernel(const vfloatn<W> &r)
+    {
+      const auto z = r * r;
+
+      auto s = z * -1.9515295891E-4f + 8.3321608736E-3f;
+      s      = z * s - 1.6666654611E-1f;
+      return (z * r) * s + r;
+    }
+
+    template <int W>
+    TSIMD_INLINE vfloatn<W> cos_kernel(const vfloatn<W> &r)
+    {
+      const auto z = r * r;
+
+      auto c = z * 2.443315711809948E-5f - 1.388731625493765E-3f;
+      c      = z * c + 4.166664568298827E-2f;
+      return (z * z) * c - 0.5f * z + 1.f;
+    }
+
+    template <int W>
+    TSIMD_INLINE vfloatn<W> sin_reduced(const vfloatn<W> &r,
+                                        const vintn<W> &q)
+    {
+      const auto s = sin_kernel(r);
+      const auto c = cos_kernel(r);
+
+      // q: 0 -> sin(r), 1 -> cos(r), 2 -> -sin(r), 3 -> -cos(r)
+      auto result = select((q & 1) == 1, c, s);
+      return select(q >= 2, -result, result);
+    }
+
+  }  // namespace detail
+
+  namespace fast {
+
+    // Max error 2.5 ulp for |x| < 6433, no handling of larger |x|, infinity
+    // or NaN
+    template <int W>
+    TSIMD_INLINE vfloatn<W> sin(const vfloatn<W> &p)
+    {
+      vfloatn<W> r;
+      vintn<W> q;
+      detail::trig_reduce(p, r, q);
+      return detail::sin_reduced(r, q);
+    }
+
+  }  // namespace fast
+
+  // Double precision //
+
+  namespace detail {
+
+    // fdlibm's minimax kernels for sin(r) and cos(r) on [-pi/4, pi/4]
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> sin_kernel(const vdoublen<W> &r)
+    {
+      static const double S1 = -1.66666666666666324348e-01;
+      static const double S2 = 8.33333333332248946124e-03;
+      static const double S3 = -1.98412698298579493134e-04;
+      static const double S4 = 2.75573137070700676789e-06;
+      static const double S5 = -2.50507602534068634195e-08;
+      static const double S6 = 1.58969099521155010221e-10;
+
+      const auto z = r * r;
+      const auto v = z * r;
+
+      auto s = z * S6 + S5;
+      s      = z * s + S4;
+      s      = z * s + S3;
+      s      = z * s + S2;
+      s      = z * s + S1;
+      return v * s + r;
+    }
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> cos_kernel(const vdoublen<W> &r)
+    {
+      static const double C1 = 4.16666666666666019037e-02;
+      static const double C2 = -1.38888888888741095749e-03;
+      static const double C3 = 2.48015872894767294178e-05;
+      static const double C4 = -2.75573143513906633035e-07;
+      static const double C5 = 2.08757232129817482790e-09;
+      static const double C6 = -1.13596475577881948265e-11;
+
+      const auto z = r * r;
+
+      auto c = z * C6 + C5;
+      c      = z * c + C4;
+      c      = z * c + C3;
+      c      = z * c + C2;
+      c      = z * c + C1;
+
+      // 1 - z/2 is split so its rounding error gets added back in
+      const auto hz = 0.5 * z;
+      const auto w  = 1.0 - hz;
+      return w + (((1.0 - w) - hz) + (z * z) * c);
+    }
+
+  }  // namespace detail
 
+  template <int W>
+  TSIMD_INLINE vdoublen<W> sin(const vdoublen<W> &p)
+  {
+    vdoublen<W> r, q;
+    detail::trig_reduce(p, r, q);
+    detail::trig_reduce_large(p, r, q);
+
+    const auto s = detail::sin_kernel(r);
+    const auto c = detail::cos_kernel(r);
+
+    // q: 0 -> sin(r), 1 -> cos(r), 2 -> -sin(r), 3 -> -cos(r)
+    const auto useCos   = (q == 1.0) | (q == 3.0);
+    const auto flipSign = q >= 2.0;
+
+    const auto result = select(useCos, c, s);
+    return select(flipSign, -result, result);
+  }
+
+  // Max error 2.5 ulp, lanes with |x| >= 6433 are reduced with Payne-Hanek
   template <int W>
   TSIMD_INLINE vfloatn<W> sin(const vfloatn<W> &p)
   {
-    static const float piOverTwoVec = 1.57079637050628662109375;
-    static const float twoOverPiVec = 0.636619746685028076171875;
-    const auto scaled = p * twoOverPiVec;
-    const auto kReal = floor(scaled);
-    const auto k = vintn<W>(kReal);
-
-    // Reduced range version of x
-    const auto x = p - kReal * piOverTwoVec;
-    const auto kMod4 = k & 3;
-    const auto sinUseCos = (kMod4 == 1 | kMod4 == 3);
-    const auto flipSign = (kMod4 > 1);
-
-    // These coefficients are from sollya with fpminimax(sin(x)/x, [|0, 2,
-    // 4, 6, 8, 10|], [|single...|], [0;Pi/2]);
-    static const float sinC2 = -0.16666667163372039794921875;
-    static const float sinC4 = 8.333347737789154052734375e-3;
-    static const float sinC6 = -1.9842604524455964565277099609375e-4;
-    static const float sinC8 = 2.760012648650445044040679931640625e-6;
-    static const float sinC10 = -2.50293279435709337121807038784027099609375e-8;
-
-    static const float cosC2 = -0.5;
-    static const float cosC4 = 4.166664183139801025390625e-2;
-    static const float cosC6 = -1.388833043165504932403564453125e-3;
-    static const float cosC8 = 2.47562347794882953166961669921875e-5;
-    static const float cosC10 = -2.59630184018533327616751194000244140625e-7;
-
-    const auto outside = select(sinUseCos, 1.f, x);
-    const auto c2 = select(sinUseCos, vfloatn<W>(cosC2), vfloatn<W>(sinC2));
-    const auto c4 = select(sinUseCos, vfloatn<W>(cosC4), vfloatn<W>(sinC4));
-    const auto c6 = select(sinUseCos, vfloatn<W>(cosC6), vfloatn<W>(sinC6));
-    const auto c8 = select(sinUseCos, vfloatn<W>(cosC8), vfloatn<W>(sinC8));
-    const auto c10 = select(sinUseCos, vfloatn<W>(cosC10), vfloatn<W>(sinC10));
-
-    const auto x2 = x * x;
-    auto formula = x2 * c10 + c8;
-    formula = x2 * formula + c6;
-    formula = x2 * formula + c4;
-    formula = x2 * formula + c2;
-    formula = x2 * formula + 1.;
-    formula *= outside;
-
-    formula = select(flipSign, -formula, formula);
-    return formula;
+    vfloatn<W> r;
+    vintn<W> q;
+    detail::trig_reduce(p, r, q);
+    detail::trig_reduce_large(p, r, q);
+    return detail::sin_reduced(r, q);
   }
 
-}  // namespace tsimd
\ No newline at end of file
+  namespace fast {
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> sin(const vdoublen<W> &p)
+    {
+      return tsimd::sin(p);
+    }
+
+  }  // namespace fast
+
+  namespace precise {
+
+    // Max error 1 ulp, evaluated in double precision and rounded
+    template <int W>
+    TSIMD_INLINE vfloatn<W> sin(const vfloatn<W> &p)
+    {
+      return vfloatn<W>(tsimd::sin(vdoublen<W>(p)));
+    }
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> sin(const vdoublen<W> &p)
+    {
+      return tsimd::sin(p);
+    }
+
+  }  // namespace precise
+
+}  // namespace tsimd
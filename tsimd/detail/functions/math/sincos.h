@@ -0,0 +1,222 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cmath>
+
+#include "../../pack.h"
+
+#include "../algorithm/select.h"
+
+#include "trig_reduce.h"
+
+namespace tsimd {
+
+  template <typename T, int W>
+  TSIMD_INLINE void sincos(const pack<T, W> &p, pack<T, W> &s, pack<T, W> &c)
+  {
+#if TSIMD_USE_OPENMP
+#  pragma omp simd
+#endif
+    for (int i = 0; i < W; ++i) {
+      s[i] = std::sin(p[i]);
+      c[i] = std::cos(p[i]);
+    }
+  }
+
+  // Single precision //
+
+  namespace detail {
+
+    // sin_kernel() and cos_kernel() evaluated side by side: both Horner
+    // chains are independent, so interleaving them hides their latency
+    template <int W>
+    TSIMD_INLINE void sincos_kernel(const vfloatn<W> &r,
+                                    vfloatn<W> &s,
+                                    vfloatn<W> &c)
+    {
+      const auto z = r * r;
+
+      auto ps = z * -1.9515295891E-4f + 8.3321608736E-3f;
+      auto pc = z * 2.443315711809948E-5f - 1.388731625493765E-3f;
+      ps      = z * ps - 1.6666654611E-1f;
+      pc      = z * pc + 4.166664568298827E-2f;
+
+      s = (z * r) * ps + r;
+      c = (z * z) * pc - 0.5f * z + 1.f;
+    }
+
+    template <int W>
+    TSIMD_INLINE void sincos_reduced(const vfloatn<W> &r,
+                                     const vintn<W> &q,
+                                     vfloatn<W> &s,
+                                     vfloatn<W> &c)
+    {
+      vfloatn<W> sr, cr;
+      sincos_kernel(r, sr, cr);
+
+      // q: 0 -> ( sin(r),  cos(r)), 1 -> ( cos(r), -sin(r)),
+      //    2 -> (-sin(r), -cos(r)), 3 -> (-cos(r),  sin(r))
+      const auto odd = (q & 1) == 1;
+
+      s = select(odd, cr, sr);
+      c = select(odd, sr, cr);
+      s = select(q >= 2, -s, s);
+      c = select(((q + 1) & 2) != 0, -c, c);
+    }
+
+  }  // namespace detail
+
+  namespace fast {
+
+    // sin(x) and cos(x) from one range reduction, max error 2.5 ulp for
+    // |x| < 6433, no handling of larger |x|, infinity or NaN
+    template <int W>
+    TSIMD_INLINE void sincos(const vfloatn<W> &p, vfloatn<W> &s, vfloatn<W> &c)
+    {
+      vfloatn<W> r;
+      vintn<W> q;
+      detail::trig_reduce(p, r, q);
+      detail::sincos_reduced(r, q, s, c);
+    }
+
+  }  // namespace fast
+
+  // sin(x) and cos(x) from one range reduction, max error 2.5 ulp, lanes
+  // with |x| >= 6433 are reduced with Payne-Hanek
+  template <int W>
+  TSIMD_INLINE void sincos(const vfloatn<W> &p, vfloatn<W> &s, vfloatn<W> &c)
+  {
+    vfloatn<W> r;
+    vintn<W> q;
+    detail::trig_reduce(p, r, q);
+    detail::trig_reduce_large(p, r, q);
+    detail::sincos_reduced(r, q, s, c);
+  }
+
+  // Double precision //
+
+  namespace detail {
+
+    // The fdlibm sin_kernel() and cos_kernel() evaluated side by side
+    template <int W>
+    TSIMD_INLINE void sincos_kernel(const vdoublen<W> &r,
+                                    vdoublen<W> &s,
+                                    vdoublen<W> &c)
+    {
+      static const double S1 = -1.66666666666666324348e-01;
+      static const double S2 = 8.33333333332248946124e-03;
+      static const double S3 = -1.98412698298579493134e-04;
+      static const double S4 = 2.75573137070700676789e-06;
+      static const double S5 = -2.50507602534068634195e-08;
+      static const double S6 = 1.58969099521155010221e-10;
+
+      static const double C1 = 4.16666666666666019037e-02;
+      static const double C2 = -1.38888888888741095749e-03;
+      static const double C3 = 2.48015872894767294178e-05;
+      static const double C4 = -2.75573143513906633035e-07;
+      static const double C5 = 2.08757232129817482790e-09;
+      static const double C6 = -1.13596475577881948265e-11;
+
+      const auto z = r * r;
+
+      auto ps = z * S6 + S5;
+      auto pc = z * C6 + C5;
+      ps      = z * ps + S4;
+      pc      = z * pc + C4;
+      ps      = z * ps + S3;
+      pc      = z * pc + C3;
+      ps      = z * ps + S2;
+      pc      = z * pc + C2;
+      ps      = z * ps + S1;
+      pc      = z * pc + C1;
+
+      s = (z * r) * ps + r;
+
+      // 1 - z/2 is split so its rounding error gets added back in
+      const auto hz = 0.5 * z;
+      const auto w  = 1.0 - hz;
+      c             = w + (((1.0 - w) - hz) + (z * z) * pc);
+    }
+
+  }  // namespace detail
+
+  template <int W>
+  TSIMD_INLINE void sincos(const vdoublen<W> &p,
+                           vdoublen<W> &s,
+                           vdoublen<W> &c)
+  {
+    vdoublen<W> r, q;
+    detail::trig_reduce(p, r, q);
+    detail::trig_reduce_large(p, r, q);
+
+    vdoublen<W> sr, cr;
+    detail::sincos_kernel(r, sr, cr);
+
+    // q: 0 -> ( sin(r),  cos(r)), 1 -> ( cos(r), -sin(r)),
+    //    2 -> (-sin(r), -cos(r)), 3 -> (-cos(r),  sin(r))
+    const auto odd = (q == 1.0) | (q == 3.0);
+
+    s = select(odd, cr, sr);
+    c = select(odd, sr, cr);
+    s = select(q >= 2.0, -s, s);
+    c = select((q == 1.0) | (q == 2.0), -c, c);
+  }
+
+  namespace fast {
+
+    template <int W>
+    TSIMD_INLINE void sincos(const vdoublen<W> &p,
+                             vdoublen<W> &s,
+                             vdoublen<W> &c)
+    {
+      tsimd::sincos(p, s, c);
+    }
+
+  }  // namespace fast
+
+  namespace precise {
+
+    // Max error 1 ulp, evaluated in double precision and rounded
+    template <int W>
+    TSIMD_INLINE void sincos(const vfloatn<W> &p, vfloatn<W> &s, vfloatn<W> &c)
+    {
+      vdoublen<W> sd, cd;
+      tsimd::sincos(vdoublen<W>(p), sd, cd);
+      s = vfloatn<W>(sd);
+      c = vfloatn<W>(cd);
+    }
+
+    template <int W>
+    TSIMD_INLINE void sincos(const vdoublen<W> &p,
+                             vdoublen<W> &s,
+                             vdoublen<W> &c)
+    {
+      tsimd::sincos(p, s, c);
+    }
+
+  }  // namespace precise
+
+}  // namespace tsimd
@@ -0,0 +1,135 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cmath>
+
+#include "../../pack.h"
+
+#include "../algorithm/select.h"
+
+#include "abs.h"
+#include "exp.h"
+#include "min.h"
+
+namespace tsimd {
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> sinh(const pack<T, W> &p)
+  {
+    pack<T, W> result;
+
+#if TSIMD_USE_OPENMP
+#  pragma omp simd
+#endif
+    for (int i = 0; i < W; ++i)
+      result[i] = std::sinh(p[i]);
+
+    return result;
+  }
+
+  // Single precision //
+
+  namespace detail {
+
+    // e^a / 2 for a >= 0, scaled in two steps so it only overflows where
+    // sinh(a) and cosh(a) do
+    template <int W>
+    TSIMD_INLINE vfloatn<W> exp_half(const vfloatn<W> &a)
+    {
+      vintn<W> n;
+      const auto y  = exp_kernel(min(a, vfloatn<W>(90.f)), n);
+      const auto n1 = (n - 1) >> 1;
+      return y * pow2(n1) * pow2(n - 1 - n1);
+    }
+
+  }  // namespace detail
+
+  // Max error 2 ulp
+  template <int W>
+  TSIMD_INLINE vfloatn<W> sinh(const vfloatn<W> &p)
+  {
+    const auto a = abs(p);
+
+    // |x| > 1: (e^|x| - e^-|x|) / 2
+    const auto h     = detail::exp_half(a);
+    const auto large = h - 0.25f / h;
+
+    // |x| <= 1: cephes sinhf polynomial
+    const auto z = a * a;
+
+    auto s = z * 2.03721912945E-4f + 8.33028376239E-3f;
+    s      = z * s + 1.66667160211E-1f;
+
+    const auto small = (s * z) * a + a;
+
+    return detail::mulsign(select(a > 1.f, large, small), p);
+  }
+
+  // Double precision //
+
+  namespace detail {
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> exp_half(const vdoublen<W> &a)
+    {
+      vllongn<W> k;
+      const auto y  = exp_kernel(a, vdoublen<W>(0.0), k);
+      const auto k1 = (k - 1) >> 1;
+      return y * pow2(k1) * pow2(k - 1 - k1);
+    }
+
+  }  // namespace detail
+
+  // Max error 2 ulp
+  template <int W>
+  TSIMD_INLINE vdoublen<W> sinh(const vdoublen<W> &p)
+  {
+    const auto a = abs(p);
+
+    // |x| > 1: (e^|x| - e^-|x|) / 2
+    const auto h     = detail::exp_half(a);
+    const auto large = h - 0.25 / h;
+
+    // |x| <= 1: the Taylor series up to x^21 / 21!, whose truncation error
+    // is below 2^-70
+    const auto z = a * a;
+
+    auto s = z * (1.0 / 51090942171709440000.0) + (1.0 / 121645100408832000.0);
+    s      = z * s + (1.0 / 355687428096000.0);
+    s      = z * s + (1.0 / 1307674368000.0);
+    s      = z * s + (1.0 / 6227020800.0);
+    s      = z * s + (1.0 / 39916800.0);
+    s      = z * s + (1.0 / 362880.0);
+    s      = z * s + (1.0 / 5040.0);
+    s      = z * s + (1.0 / 120.0);
+    s      = z * s + (1.0 / 6.0);
+
+    const auto small = (s * z) * a + a;
+
+    return detail::mulsign(select(a > 1.0, large, small), p);
+  }
+
+}  // namespace tsimd
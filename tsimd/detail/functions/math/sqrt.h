@@ -28,6 +28,8 @@
 
 #include "../../pack.h"
 
+#include "../algorithm/select.h"
+
 namespace tsimd {
 
   // 1-wide //
@@ -38,6 +40,22 @@ namespace tsimd {
     return pack<T, 1>(std::sqrt(p[0]));
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 sqrt(const vdouble2 &p)
+  {
+#if defined(__SSE__)
+    return _mm_sqrt_pd(p);
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = std::sqrt(p[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 sqrt(const vfloat4 &p)
@@ -54,6 +72,20 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vdouble4 sqrt(const vdouble4 &p)
+  {
+#if defined(__AVX__)
+    return _mm256_sqrt_pd(p);
+#else
+    vdouble4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = std::sqrt(p[i]);
+
+    return result;
+#endif
+  }
+
   // 8-wide //
 
   TSIMD_INLINE vfloat8 sqrt(const vfloat8 &p)
@@ -65,6 +97,15 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vdouble8 sqrt(const vdouble8 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_sqrt_pd(p);
+#else
+    return vdouble8(sqrt(vdouble4(p.vl)), sqrt(vdouble4(p.vh)));
+#endif
+  }
+
   // 16-wide //
 
   TSIMD_INLINE vfloat16 sqrt(const vfloat16 &p)
@@ -76,4 +117,112 @@ namespace tsimd {
 #endif
   }
 
+  // Composite widths //
+
+  template <typename T, int W, typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> sqrt(const pack<T, W> &p)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(sqrt(half_pack(p.vl)), sqrt(half_pack(p.vh)));
+  }
+
+  namespace detail {
+
+    // Hardware reciprocal square root estimates, relative error <= 1.5 *
+    // 2^-12 (2^-14 with AVX-512)
+
+    // 1-wide //
+
+    TSIMD_INLINE vfloat1 rsqrt_estimate(const vfloat1 &p)
+    {
+      return vfloat1(1.f / std::sqrt(p[0]));
+    }
+
+    // 4-wide //
+
+    TSIMD_INLINE vfloat4 rsqrt_estimate(const vfloat4 &p)
+    {
+#if defined(__AVX512VL__)
+      return _mm_rsqrt14_ps(p);
+#elif defined(__SSE__)
+      return _mm_rsqrt_ps(p);
+#else
+      vfloat4 result;
+
+      for (int i = 0; i < 4; ++i)
+        result[i] = 1.f / std::sqrt(p[i]);
+
+      return result;
+#endif
+    }
+
+    // 8-wide //
+
+    TSIMD_INLINE vfloat8 rsqrt_estimate(const vfloat8 &p)
+    {
+#if defined(__AVX512VL__)
+      return _mm256_rsqrt14_ps(p);
+#elif defined(__AVX2__) || defined(__AVX__)
+      return _mm256_rsqrt_ps(p);
+#else
+      return vfloat8(rsqrt_estimate(vfloat4(p.vl)),
+                     rsqrt_estimate(vfloat4(p.vh)));
+#endif
+    }
+
+    // 16-wide //
+
+    TSIMD_INLINE vfloat16 rsqrt_estimate(const vfloat16 &p)
+    {
+#if defined(__AVX512F__)
+      return _mm512_rsqrt14_ps(p);
+#else
+      return vfloat16(rsqrt_estimate(vfloat8(p.vl)),
+                      rsqrt_estimate(vfloat8(p.vh)));
+#endif
+    }
+
+    // Composite widths //
+
+    template <int W, typename = traits::has_halves_t<W>>
+    TSIMD_INLINE vfloatn<W> rsqrt_estimate(const vfloatn<W> &p)
+    {
+      using half_pack = vfloatn<W / 2>;
+      return vfloatn<W>(rsqrt_estimate(half_pack(p.vl)),
+                        rsqrt_estimate(half_pack(p.vh)));
+    }
+
+  }  // namespace detail
+
+  namespace fast {
+
+    // x * rsqrt(x) refined by one Newton-Raphson step, max error 3 ulp for
+    // 0 and normal x > 0. Infinity gives NaN.
+    template <int W>
+    TSIMD_INLINE vfloatn<W> sqrt(const vfloatn<W> &p)
+    {
+      const auto r = detail::rsqrt_estimate(p);
+      const auto s = p * r;
+      const auto result = s + (0.5f * s) * (1.f - s * r);
+      return select(p == 0.f, p, result);
+    }
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> sqrt(const vdoublen<W> &p)
+    {
+      return tsimd::sqrt(p);
+    }
+
+  }  // namespace fast
+
+  namespace precise {
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> sqrt(const pack<T, W> &p)
+    {
+      return tsimd::sqrt(p);
+    }
+
+  }  // namespace precise
+
 }  // namespace tsimd
\ No newline at end of file
@@ -29,7 +29,6 @@
 #include "../../pack.h"
 
 #include "../algorithm/select.h"
-#include "../algorithm/set_if.h"
 
 #include "cos.h"
 #include "sin.h"
@@ -50,74 +49,164 @@ namespace tsimd {
     return result;
   }
 
+  // Single precision //
+
+  namespace detail {
+
+    // cephes tanf polynomial on [-pi/4, pi/4], odd quadrants return
+    // -1 / tan(r)
+    template <int W>
+    TSIMD_INLINE vfloatn<W> tan_kernel(const vfloatn<W> &r,
+                                       const mask<float, W> &odd)
+    {
+      const auto z = r * r;
+
+      auto y = z * 9.38540185543E-3f + 3.11992232697E-3f;
+      y      = z * y + 2.44301354525E-2f;
+      y      = z * y + 5.34112807005E-2f;
+      y      = z * y + 1.33387994085E-1f;
+      y      = z * y + 3.33331568548E-1f;
+
+      const auto t = (z * r) * y + r;
+      return select(odd, -1.f / t, t);
+    }
+
+  }  // namespace detail
+
+  namespace fast {
+
+    // Max error 4 ulp for |x| < 6433, no handling of larger |x|, infinity
+    // or NaN
+    template <int W>
+    TSIMD_INLINE vfloatn<W> tan(const vfloatn<W> &p)
+    {
+      vfloatn<W> r;
+      vintn<W> q;
+      detail::trig_reduce(p, r, q);
+      return detail::tan_kernel(r, (q & 1) == 1);
+    }
+
+  }  // namespace fast
+
+  // Double precision //
+
+  namespace detail {
+
+    // fdlibm's tan kernel on [-pi/4, pi/4]: odd quadrants return
+    // -1 / tan(r), computed with a corrected reciprocal
+    template <int W>
+    TSIMD_INLINE vdoublen<W> tan_kernel(const vdoublen<W> &r,
+                                        const mask<double, W> &odd)
+    {
+      static const double T0  = 3.33333333333334091986e-01;
+      static const double T1  = 1.33333333333201242699e-01;
+      static const double T2  = 5.39682539762260521377e-02;
+      static const double T3  = 2.18694882948595424599e-02;
+      static const double T4  = 8.86323982359930005737e-03;
+      static const double T5  = 3.59207910759131235356e-03;
+      static const double T6  = 1.45620945432529025516e-03;
+      static const double T7  = 5.88041240820264096874e-04;
+      static const double T8  = 2.46463134818469906812e-04;
+      static const double T9  = 7.81794442939557092300e-05;
+      static const double T10 = 7.14072491382608190305e-05;
+      static const double T11 = -1.85586374855275456654e-05;
+      static const double T12 = 2.59073051863633712884e-05;
+
+      static const double pio4   = 7.85398163397448278999e-01;
+      static const double pio4lo = 3.06161699786838301793e-17;
+
+      // Near pi/4, use tan(pi/4 - x) = (1 - tan(x)) / (1 + tan(x))
+      const auto big = abs(r) >= 0.6744;
+      const auto x   = select(big, (pio4 - abs(r)) + pio4lo, r);
+
+      const auto z = x * x;
+      const auto w = z * z;
+
+      auto rr = w * T11 + T9;
+      rr      = w * rr + T7;
+      rr      = w * rr + T5;
+      rr      = w * rr + T3;
+      rr      = w * rr + T1;
+
+      auto v = w * T12 + T10;
+      v      = w * v + T8;
+      v      = w * v + T6;
+      v      = w * v + T4;
+      v      = w * v + T2;
+      v *= z;
+
+      const auto s = z * x;
+      rr           = z * (s * (rr + v)) + T0 * s;
+      const auto t = x + rr;
+
+      // |r| >= 0.6744
+      const auto iy = select(odd, vdoublen<W>(-1.0), vdoublen<W>(1.0));
+      auto bigResult = iy - 2.0 * (x - (t * t / (t + iy) - rr));
+      bigResult      = select(r < 0.0, -bigResult, bigResult);
+
+      // -1 / t, with t and its reciprocal split so the correction is exact
+      static const long long hiMask = 0xffffffff00000000ll;
+
+      const auto th = reinterpret_elements_as<double>(
+          reinterpret_elements_as<long long>(t) & hiMask);
+      const auto tl = rr - (th - x);
+      const auto a  = -1.0 / t;
+      const auto ah = reinterpret_elements_as<double>(
+          reinterpret_elements_as<long long>(a) & hiMask);
+      const auto e  = 1.0 + ah * th;
+      const auto cotResult = ah + a * (e + ah * tl);
+
+      return select(big, bigResult, select(odd, cotResult, t));
+    }
+
+  }  // namespace detail
+
+  template <int W>
+  TSIMD_INLINE vdoublen<W> tan(const vdoublen<W> &p)
+  {
+    vdoublen<W> r, q;
+    detail::trig_reduce(p, r, q);
+    detail::trig_reduce_large(p, r, q);
+
+    return detail::tan_kernel(r, (q == 1.0) | (q == 3.0));
+  }
+
+  // Max error 4 ulp, lanes with |x| >= 6433 are reduced with Payne-Hanek
   template <int W>
   TSIMD_INLINE vfloatn<W> tan(const vfloatn<W> &p)
   {
-    static const float piOverFourVec = 0.785398185253143310546875;
-    static const float fourOverPiVec = 1.27323949337005615234375;
-
-    const auto xLt0 = p < 0.;
-    const auto y = select(xLt0, -p, p);
-    const auto scaled = y * fourOverPiVec;
-
-    const auto kReal = floor(scaled);
-    const auto k = vintn<W>(kReal);
-
-    auto x = y - kReal * piOverFourVec;
-
-    // If k & 1, x -= Pi/4
-    const auto needOffset = (k & 1) != 0;
-    set_if(x, x - piOverFourVec, needOffset);
-
-    // If k & 3 == (0 or 3) let z = tan_In...(y) otherwise z = -cot_In0To...
-    const auto kMod4 = k & 3;
-    const auto useCotan = (kMod4 == 1) | (kMod4 == 2);
-
-    static const float oneVec = 1.0;
-
-    static const float tanC2 = 0.33333075046539306640625;
-    static const float tanC4 = 0.13339905440807342529296875;
-    static const float tanC6 = 5.3348250687122344970703125e-2;
-    static const float tanC8 = 2.46033705770969390869140625e-2;
-    static const float tanC10 = 2.892402000725269317626953125e-3;
-    static const float tanC12 = 9.500005282461643218994140625e-3;
-
-    static const float cotC2 = -0.3333333432674407958984375;
-    static const float cotC4 = -2.222204394638538360595703125e-2;
-    static const float cotC6 = -2.11752182804048061370849609375e-3;
-    static const float cotC8 = -2.0846328698098659515380859375e-4;
-    static const float cotC10 = -2.548247357481159269809722900390625e-5;
-    static const float cotC12 = -3.5257363606433500535786151885986328125e-7;
-
-    const auto x2 = x * x;
-
-    vfloatn<W> z;
-    if (any(useCotan)) {
-      auto cotVal = x2 * cotC12 + cotC10;
-      cotVal = x2 * cotVal + cotC8;
-      cotVal = x2 * cotVal + cotC6;
-      cotVal = x2 * cotVal + cotC4;
-      cotVal = x2 * cotVal + cotC2;
-      cotVal = x2 * cotVal + oneVec;
-      // The equation is for x * cot(x) but we need -x * cot(x) for the tan part
-      cotVal /= -x;
-      z = cotVal;
+    vfloatn<W> r;
+    vintn<W> q;
+    detail::trig_reduce(p, r, q);
+    detail::trig_reduce_large(p, r, q);
+    return detail::tan_kernel(r, (q & 1) == 1);
+  }
+
+  namespace fast {
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> tan(const vdoublen<W> &p)
+    {
+      return tsimd::tan(p);
+    }
+
+  }  // namespace fast
+
+  namespace precise {
+
+    // Max error 1 ulp, evaluated in double precision and rounded
+    template <int W>
+    TSIMD_INLINE vfloatn<W> tan(const vfloatn<W> &p)
+    {
+      return vfloatn<W>(tsimd::tan(vdoublen<W>(p)));
     }
 
-    const auto useTan = vboolfn<W>(!useCotan);
-    if (any(useTan)) {
-      auto tanVal = x2 * tanC12 + tanC10;
-      tanVal = x2 * tanVal + tanC8;
-      tanVal = x2 * tanVal + tanC6;
-      tanVal = x2 * tanVal + tanC4;
-      tanVal = x2 * tanVal + tanC2;
-      tanVal = x2 * tanVal + oneVec;
-      // Equation was for tan(x)/x
-      tanVal *= x;
-      set_if(z, tanVal, useTan);
+    template <int W>
+    TSIMD_INLINE vdoublen<W> tan(const vdoublen<W> &p)
+    {
+      return tsimd::tan(p);
     }
 
-    return select(xLt0, -z, z);
-  }
+  }  // namespace precise
 
-}  // namespace tsimd
\ No newline at end of file
+}  // namespace tsimd
@@ -0,0 +1,111 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cmath>
+
+#include "../../pack.h"
+
+#include "../algorithm/select.h"
+
+#include "abs.h"
+#include "exp.h"
+
+namespace tsimd {
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> tanh(const pack<T, W> &p)
+  {
+    pack<T, W> result;
+
+#if TSIMD_USE_OPENMP
+#  pragma omp simd
+#endif
+    for (int i = 0; i < W; ++i)
+      result[i] = std::tanh(p[i]);
+
+    return result;
+  }
+
+  // Single precision //
+
+  // Max error 2 ulp
+  template <int W>
+  TSIMD_INLINE vfloatn<W> tanh(const vfloatn<W> &p)
+  {
+    const auto a = abs(p);
+
+    // |x| >= 0.625: 1 - 2 / (e^2|x| + 1), which goes to 1 as e^2|x|
+    // overflows
+    const auto large = 1.f - 2.f / (exp(a + a) + 1.f);
+
+    // |x| < 0.625: cephes tanhf polynomial
+    const auto z = a * a;
+
+    auto t = z * -5.70498872745E-3f + 2.06390887954E-2f;
+    t      = z * t - 5.37397155531E-2f;
+    t      = z * t + 1.33314422036E-1f;
+    t      = z * t - 3.33332819422E-1f;
+
+    const auto small = (t * z) * a + a;
+
+    return detail::mulsign(select(a >= 0.625f, large, small), p);
+  }
+
+  // Double precision //
+
+  // Max error 2 ulp
+  template <int W>
+  TSIMD_INLINE vdoublen<W> tanh(const vdoublen<W> &p)
+  {
+    static const double P0 = -9.64399179425052238628E-1;
+    static const double P1 = -9.92877231001918586564E1;
+    static const double P2 = -1.61468768441708447952E3;
+
+    static const double Q0 = 1.12811678491632931402E2;
+    static const double Q1 = 2.23548839060100448583E3;
+    static const double Q2 = 4.84406305325125486048E3;
+
+    const auto a = abs(p);
+
+    // |x| >= 0.625: 1 - 2 / (e^2|x| + 1)
+    const auto large = 1.0 - 2.0 / (exp(a + a) + 1.0);
+
+    // |x| < 0.625: cephes tanh, x + x^3 * P(x^2) / Q(x^2)
+    const auto z = a * a;
+
+    auto tp = z * P0 + P1;
+    tp      = z * tp + P2;
+
+    auto tq = z + Q0;
+    tq      = z * tq + Q1;
+    tq      = z * tq + Q2;
+
+    const auto small = a * (z * tp / tq) + a;
+
+    return detail::mulsign(select(a >= 0.625, large, small), p);
+  }
+
+}  // namespace tsimd
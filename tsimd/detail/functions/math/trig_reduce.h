@@ -0,0 +1,269 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "../../pack.h"
+
+#include "../algorithm/any.h"
+
+#include "abs.h"
+#include "floor.h"
+
+namespace tsimd {
+  namespace detail {
+
+    // Payne-Hanek reduction of a finite x to r in [-pi/4, pi/4] and the
+    // quadrant q = k mod 4, where x = k * pi/2 + r. x * 2/pi is evaluated in
+    // fixed point with a 192 bit window of 2/pi, skipping the leading bits
+    // which only add multiples of 4 to k. r is within 0.5 ulp for any x.
+
+    // 2/pi, 32 bits per word (enough for the largest double exponent)
+    static const uint32_t two_over_pi_bits[] = {
+        0xa2f9836e, 0x4e441529, 0xfc2757d1, 0xf534ddc0, 0xdb629599,
+        0x3c439041, 0xfe5163ab, 0xdebbc561, 0xb7246e3a, 0x424dd2e0,
+        0x06492eea, 0x09d1921c, 0xfe1deb1c, 0xb129a73e, 0xe88235f5,
+        0x2ebb4484, 0xe99c7026, 0xb45f7e41, 0x3991d639, 0x835339f4,
+        0x9c845f8b, 0xbdf9283b, 0x1ff897ff, 0xde05980f, 0xef2f118b,
+        0x5a0a6d1f, 0x6d367ecf, 0x27cb09b7, 0x4f463f66, 0x9e5fea2d,
+        0x7527bac7, 0xebe5f17b, 0x3d0739f7, 0x8a5292ea, 0x6bfb5fb1,
+        0x1f8d5d08, 0x56033046, 0xfc7b6bab};
+
+    // pi/2 * 2^126, least significant word first
+    static const uint32_t pio2_bits[] = {
+        0xc06e0e68, 0x62633145, 0x10b4611a, 0x6487ed51};
+
+    // out[0, na + nb) = a * b, least significant words first
+    inline void mul_words(const uint32_t *a,
+                          int na,
+                          const uint32_t *b,
+                          int nb,
+                          uint32_t *out)
+    {
+      for (int i = 0; i < na + nb; ++i)
+        out[i] = 0;
+
+      for (int i = 0; i < na; ++i) {
+        uint64_t carry = 0;
+        for (int j = 0; j < nb; ++j) {
+          const uint64_t t = uint64_t(a[i]) * b[j] + out[i + j] + carry;
+          out[i + j]       = uint32_t(t);
+          carry            = t >> 32;
+        }
+        out[i + nb] = uint32_t(carry);
+      }
+    }
+
+    // Bits [lo, lo + 64) of a little endian word array, which must have two
+    // (zero) words past the highest word read
+    inline uint64_t bits64(const uint32_t *words, int lo)
+    {
+      const int w   = lo / 32;
+      const int s   = lo % 32;
+      const auto lw = uint64_t(words[w]) | (uint64_t(words[w + 1]) << 32);
+      return s == 0 ? lw : (lw >> s) | (uint64_t(words[w + 2]) << (64 - s));
+    }
+
+    inline int trig_reduce_large(double x, double &r)
+    {
+      uint64_t xbits;
+      std::memcpy(&xbits, &x, sizeof(x));
+
+      // |x| = m * 2^e, m a 53 bit integer
+      const uint64_t m = (xbits & 0x000fffffffffffffull) | (1ull << 52);
+      const int e      = int((xbits >> 52) & 0x7ff) - 1075;
+
+      // The window starts at bit j0 of 2/pi (2^-j0); earlier bits j have
+      // m * 2^(e - j) a multiple of 4
+      const int j0    = e - 1 > 1 ? e - 1 : 1;
+      const int s     = (j0 - 1) % 32;
+      const auto *tbl = two_over_pi_bits + (j0 - 1) / 32;
+
+      uint32_t window[6];
+      for (int i = 0; i < 6; ++i) {
+        window[5 - i] =
+            s == 0 ? tbl[i] : (tbl[i] << s) | (tbl[i + 1] >> (32 - s));
+      }
+
+      // x * 2/pi = product * 2^-point (mod 4)
+      const uint32_t mw[2] = {uint32_t(m), uint32_t(m >> 32)};
+      uint32_t product[10];
+      mul_words(mw, 2, window, 6, product);
+      product[8] = product[9] = 0;
+
+      const int point = j0 + 191 - e;
+
+      int q       = int(bits64(product, point) & 3);
+      uint64_t fh = bits64(product, point - 64);
+      uint64_t fl = bits64(product, point - 128);
+
+      // Round k to nearest, leaving |f| <= 1/2 in sign-magnitude
+      const bool negative = (fh >> 63) != 0;
+      if (negative) {
+        q  = (q + 1) & 3;
+        fl = ~fl + 1;
+        fh = ~fh + (fl == 0 ? 1 : 0);
+      }
+
+      // r = f * pi/2, rounded once from the top 64 bits of the product
+      const uint32_t fw[4] = {
+          uint32_t(fl), uint32_t(fl >> 32), uint32_t(fh), uint32_t(fh >> 32)};
+      uint32_t rw[10];
+      mul_words(fw, 4, pio2_bits, 4, rw);
+      rw[8] = rw[9] = 0;
+
+      int top = 255;
+      while (top >= 0 && ((rw[top / 32] >> (top % 32)) & 1) == 0)
+        --top;
+
+      if (top < 64) {
+        r = 0.0;
+      } else {
+        // Keep a sticky bit for the bits below the 64 taken, so the
+        // conversion rounds correctly
+        const int lo = top - 63;
+        bool sticky  = (rw[lo / 32] & ((1u << (lo % 32)) - 1)) != 0;
+        for (int i = 0; i < lo / 32; ++i)
+          sticky |= rw[i] != 0;
+
+        const uint64_t mant = bits64(rw, lo) | (sticky ? 1 : 0);
+
+        // f has 128 and pi/2 has 126 fractional bits
+        r = std::ldexp(double(mant), lo - 254);
+      }
+
+      if (negative)
+        r = -r;
+
+      if (x < 0.0) {
+        r = -r;
+        q = (4 - q) & 3;
+      }
+
+      return q;
+    }
+
+    // Single precision //
+
+    // Cody-Waite reduction of x to r in [-pi/4, pi/4] and the quadrant
+    // q = k mod 4, where x = k * pi/2 + r. pi/2 is split in four parts, the
+    // first three with 12 significant bits so their products with k are
+    // exact for |x| < trig_reduce_maxf
+    static const float trig_reduce_maxf = 6433.f;  // ~2^12 * pi/2
+
+    template <int W>
+    TSIMD_INLINE void trig_reduce(const vfloatn<W> &x,
+                                  vfloatn<W> &r,
+                                  vintn<W> &q)
+    {
+      static const float shifter   = 12582912.f;  // 1.5 * 2^23
+      static const int kShift      = 0x4b400000;
+      static const float twoOverPi = 6.36619746685028076172e-01f;
+
+      static const float pio2_1 = 1.57080078125000000000e+00f;
+      static const float pio2_2 = -4.45358455181121826172e-06f;
+      static const float pio2_3 = -8.70613803272135555744e-10f;
+      static const float pio2_4 = 6.22337196966998851266e-14f;
+
+      const auto t  = x * twoOverPi + shifter;
+      const auto kf = t - shifter;
+      q             = (reinterpret_elements_as<int>(t) - kShift) & 3;
+
+      r = x - kf * pio2_1;
+      r -= kf * pio2_2;
+      r -= kf * pio2_3;
+      r -= kf * pio2_4;
+    }
+
+    // Redoes the finite lanes past trig_reduce()'s range with Payne-Hanek
+    // (infinity and NaN are left to produce NaN)
+    template <int W>
+    TSIMD_INLINE void trig_reduce_large(const vfloatn<W> &x,
+                                        vfloatn<W> &r,
+                                        vintn<W> &q)
+    {
+      const auto large = abs(x) >= trig_reduce_maxf &
+                         abs(x) <= std::numeric_limits<float>::max();
+      if (any(large)) {
+        for (int i = 0; i < W; ++i) {
+          if (large[i]) {
+            double rd;
+            q[i] = trig_reduce_large(double(x[i]), rd);
+            r[i] = float(rd);
+          }
+        }
+      }
+    }
+
+    // Double precision //
+
+    // Cody-Waite reduction of x to r in [-pi/4, pi/4] and the quadrant
+    // q = k mod 4 (as a double), where x = k * pi/2 + r. pio2_1 and pio2_2
+    // have 33 significant bits, so k * pio2_1 and k * pio2_2 are exact for
+    // |x| < trig_reduce_max
+    static const double trig_reduce_max = 1647099.3291652855; // 2^20 * pi/2
+
+    template <int W>
+    TSIMD_INLINE void trig_reduce(const vdoublen<W> &x,
+                                  vdoublen<W> &r,
+                                  vdoublen<W> &q)
+    {
+      static const double shifter = 6755399441055744.0;  // 1.5 * 2^52
+      static const double twoOverPi = 6.36619772367581382433e-01;
+
+      static const double pio2_1 = 1.57079632673412561417e+00;
+      static const double pio2_2 = 6.07710050630396597660e-11;
+      static const double pio2_3 = 2.02226624871116645580e-21;
+
+      const auto kd = (x * twoOverPi + shifter) - shifter;
+
+      r = ((x - kd * pio2_1) - kd * pio2_2) - kd * pio2_3;
+      q = kd - 4.0 * floor(kd * 0.25);
+    }
+
+    template <int W>
+    TSIMD_INLINE void trig_reduce_large(const vdoublen<W> &x,
+                                        vdoublen<W> &r,
+                                        vdoublen<W> &q)
+    {
+      const auto large = abs(x) >= trig_reduce_max &
+                         abs(x) <= std::numeric_limits<double>::max();
+      if (any(large)) {
+        for (int i = 0; i < W; ++i) {
+          if (large[i]) {
+            double rd;
+            q[i] = trig_reduce_large(x[i], rd);
+            r[i] = rd;
+          }
+        }
+      }
+    }
+
+  }  // namespace detail
+}  // namespace tsimd
@@ -26,5 +26,9 @@
 
 #include "memory/gather.h"
 #include "memory/load.h"
+#include "memory/load_bf16.h"
+#include "memory/load_half.h"
 #include "memory/scatter.h"
 #include "memory/store.h"
+#include "memory/store_bf16.h"
+#include "memory/store_half.h"
@@ -81,6 +81,18 @@ namespace tsimd {
     return detail::load1<vint1>(_src, m);
   }
 
+  template <>
+  TSIMD_INLINE vuint1 load(const void *_src)
+  {
+    return detail::load1<vuint1>(_src);
+  }
+
+  template <>
+  TSIMD_INLINE vuint1 load(const void *_src, const vboolf1 &m)
+  {
+    return detail::load1<vuint1>(_src, m);
+  }
+
   template <>
   TSIMD_INLINE vdouble1 load(const void *_src)
   {
@@ -105,6 +117,126 @@ namespace tsimd {
     return detail::load1<vllong1>(_src, m);
   }
 
+  template <>
+  TSIMD_INLINE vschar1 load(const void *_src)
+  {
+    return detail::load1<vschar1>(_src);
+  }
+
+  template <>
+  TSIMD_INLINE vschar1 load(const void *_src, const vboolb1 &m)
+  {
+    return detail::load1<vschar1>(_src, m);
+  }
+
+  template <>
+  TSIMD_INLINE vuchar1 load(const void *_src)
+  {
+    return detail::load1<vuchar1>(_src);
+  }
+
+  template <>
+  TSIMD_INLINE vuchar1 load(const void *_src, const vboolb1 &m)
+  {
+    return detail::load1<vuchar1>(_src, m);
+  }
+
+  template <>
+  TSIMD_INLINE vshort1 load(const void *_src)
+  {
+    return detail::load1<vshort1>(_src);
+  }
+
+  template <>
+  TSIMD_INLINE vshort1 load(const void *_src, const vboolw1 &m)
+  {
+    return detail::load1<vshort1>(_src, m);
+  }
+
+  template <>
+  TSIMD_INLINE vushort1 load(const void *_src)
+  {
+    return detail::load1<vushort1>(_src);
+  }
+
+  template <>
+  TSIMD_INLINE vushort1 load(const void *_src, const vboolw1 &m)
+  {
+    return detail::load1<vushort1>(_src, m);
+  }
+
+  // 2-wide //
+
+  template <>
+  TSIMD_INLINE vdouble2 load(const void *_src)
+  {
+#if defined(__SSE__)
+    return _mm_load_pd((const double *)_src);
+#else
+    auto *src = (const typename vdouble2::value_t *)_src;
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble2 load(const void *_src, const vboold2 &mask)
+  {
+#if defined(__AVX512VL__)
+    return _mm_mask_loadu_pd(_mm_setzero_pd(), mask, _src);
+#elif defined(__AVX__)
+    return _mm_maskload_pd((const double *)_src, mask);
+#else
+    auto *src = (const typename vdouble2::value_t *)_src;
+    vdouble2 result(0.0);
+
+    for (int i = 0; i < 2; ++i)
+      if (mask[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong2 load(const void *_src)
+  {
+#if defined(__SSE__)
+    return _mm_load_si128((const __m128i *)_src);
+#else
+    auto *src = (const typename vllong2::value_t *)_src;
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong2 load(const void *_src, const vboold2 &mask)
+  {
+#if defined(__AVX512VL__)
+    return _mm_mask_loadu_epi64(_mm_setzero_si128(), mask, _src);
+#elif defined(__AVX__)
+    return _mm_castpd_si128(_mm_maskload_pd((const double *)_src, mask));
+#else
+    auto *src = (const typename vllong2::value_t *)_src;
+    vllong2 result(0);
+
+    for (int i = 0; i < 2; ++i)
+      if (mask[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   template <>
@@ -126,7 +258,9 @@ namespace tsimd {
   template <>
   TSIMD_INLINE vfloat4 load(const void *_src, const vboolf4 &mask)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return _mm_mask_loadu_ps(_mm_setzero_ps(), mask, _src);
+#elif defined(__SSE__)
     return _mm_and_ps(_mm_load_ps((const float *)_src), mask);
 #else
     auto *src = (const typename vfloat4::value_t *)_src;
@@ -157,9 +291,27 @@ namespace tsimd {
   }
 
   template <>
-  TSIMD_INLINE vint4 load(const void *_src, const vboolf4 &mask)
+  TSIMD_INLINE vuint4 load(const void *_src)
   {
 #if defined(__SSE__)
+    return _mm_load_si128((const __m128i *)_src);
+#else
+    auto *src = (const typename vuint4::value_t *)_src;
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint4 load(const void *_src, const vboolf4 &mask)
+  {
+#if defined(__AVX512VL__)
+    return _mm_mask_loadu_epi32(_mm_setzero_si128(), mask, _src);
+#elif defined(__SSE__)
     return _mm_and_si128(_mm_load_si128((const __m128i *)_src), mask);
 #else
     auto *src = (const typename vint4::value_t *)_src;
@@ -173,6 +325,96 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE vuint4 load(const void *_src, const vboolf4 &mask)
+  {
+#if defined(__AVX512VL__)
+    return _mm_mask_loadu_epi32(_mm_setzero_si128(), mask, _src);
+#elif defined(__SSE__)
+    return _mm_and_si128(_mm_load_si128((const __m128i *)_src), mask);
+#else
+    auto *src = (const typename vuint4::value_t *)_src;
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble4 load(const void *_src)
+  {
+#if defined(__AVX__)
+    return _mm256_load_pd((const double *)_src);
+#else
+    auto *src = (const typename vdouble4::value_t *)_src;
+    vdouble4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble4 load(const void *_src, const vboold4 &mask)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_mask_loadu_pd(_mm256_setzero_pd(), mask, _src);
+#elif defined(__AVX__)
+    return _mm256_maskload_pd((const double *)_src, mask);
+#else
+    auto *src = (const typename vdouble4::value_t *)_src;
+    vdouble4 result(0.0);
+
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong4 load(const void *_src)
+  {
+#if defined(__AVX__)
+    return _mm256_castpd_si256(_mm256_load_pd((const double *)_src));
+#else
+    auto *src = (const typename vllong4::value_t *)_src;
+    vllong4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong4 load(const void *_src, const vboold4 &mask)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_mask_loadu_epi64(_mm256_setzero_si256(), mask, _src);
+#elif defined(__AVX__)
+    return _mm256_castpd_si256(
+        _mm256_maskload_pd((const double *)_src, mask));
+#else
+    auto *src = (const typename vllong4::value_t *)_src;
+    vllong4 result(0);
+
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
   // 8-wide //
 
   template <>
@@ -189,8 +431,8 @@ namespace tsimd {
   template <>
   TSIMD_INLINE vfloat8 load(const void *_src, const vboolf8 &mask)
   {
-#if 0  // defined(__AVX512__)
-    return _mm256_mask_load_ps(_mm256_setzero_ps(), mask, (float*)_src);
+#if defined(__AVX512VL__)
+    return _mm256_mask_loadu_ps(_mm256_setzero_ps(), mask, _src);
 #elif defined(__AVX__)
     return _mm256_maskload_ps((const float *)_src, _mm256_castps_si256(mask));
 #else
@@ -211,11 +453,22 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE vuint8 load(const void *_src)
+  {
+#if defined(__AVX512__) || defined(__AVX__)
+    return _mm256_castps_si256(_mm256_load_ps((const float *)_src));
+#else
+    auto *src = (const typename vuint16::value_t *)_src;
+    return vuint8(load<vuint4>(src), load<vuint4>(src + 4));
+#endif
+  }
+
   template <>
   TSIMD_INLINE vint8 load(const void *_src, const vboolf8 &mask)
   {
-#if 0  // defined(__AVX512__)
-    return _mm256_castps_si256(_mm256_maskload_ps((float*)_src, mask));
+#if defined(__AVX512VL__)
+    return _mm256_mask_loadu_epi32(_mm256_setzero_si256(), mask, _src);
 #elif defined(__AVX__)
     return _mm256_castps_si256(
         _mm256_maskload_ps((const float *)_src, _mm256_castps_si256(mask)));
@@ -226,6 +479,133 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE vuint8 load(const void *_src, const vboolf8 &mask)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_mask_loadu_epi32(_mm256_setzero_si256(), mask, _src);
+#elif defined(__AVX__)
+    return _mm256_castps_si256(
+        _mm256_maskload_ps((const float *)_src, _mm256_castps_si256(mask)));
+#else
+    auto *src = (const typename vuint16::value_t *)_src;
+    return vuint8(load<vuint4>(src, vboolf4(mask.vl)),
+                  load<vuint4>(src + 4, vboolf4(mask.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble8 load(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_load_pd((const double *)_src);
+#else
+    auto *src = (const typename vdouble8::value_t *)_src;
+    return vdouble8(load<vdouble4>(src), load<vdouble4>(src + 4));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble8 load(const void *_src, const vboold8 &mask)
+  {
+#if defined(__AVX512F__)
+    return _mm512_mask_loadu_pd(_mm512_setzero_pd(), mask, _src);
+#else
+    auto *src = (const typename vdouble8::value_t *)_src;
+    return vdouble8(load<vdouble4>(src, vboold4(mask.vl)),
+                    load<vdouble4>(src + 4, vboold4(mask.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong8 load(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_load_si512(_src);
+#else
+    auto *src = (const typename vllong8::value_t *)_src;
+    return vllong8(load<vllong4>(src), load<vllong4>(src + 4));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong8 load(const void *_src, const vboold8 &mask)
+  {
+#if defined(__AVX512F__)
+    return _mm512_mask_loadu_epi64(_mm512_setzero_si512(), mask, _src);
+#else
+    auto *src = (const typename vllong8::value_t *)_src;
+    return vllong8(load<vllong4>(src, vboold4(mask.vl)),
+                   load<vllong4>(src + 4, vboold4(mask.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort8 load(const void *_src)
+  {
+#if defined(__SSE__)
+    return _mm_load_si128((const __m128i *)_src);
+#else
+    auto *src = (const typename vshort8::value_t *)_src;
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort8 load(const void *_src, const vboolw8 &mask)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(_mm_load_si128((const __m128i *)_src), mask);
+#else
+    auto *src = (const typename vshort8::value_t *)_src;
+    vshort8 result(0);
+
+    for (int i = 0; i < 8; ++i)
+      if (mask[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort8 load(const void *_src)
+  {
+#if defined(__SSE__)
+    return _mm_load_si128((const __m128i *)_src);
+#else
+    auto *src = (const typename vushort8::value_t *)_src;
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort8 load(const void *_src, const vboolw8 &mask)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(_mm_load_si128((const __m128i *)_src), mask);
+#else
+    auto *src = (const typename vushort8::value_t *)_src;
+    vushort8 result(0);
+
+    for (int i = 0; i < 8; ++i)
+      if (mask[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
   // 16-wide //
 
   template <>
@@ -243,7 +623,7 @@ namespace tsimd {
   TSIMD_INLINE vfloat16 load(const void *_src, const vboolf16 &mask)
   {
 #if defined(__AVX512F__)
-    return _mm512_mask_load_ps(_mm512_setzero_ps(), mask, (float *)_src);
+    return _mm512_mask_loadu_ps(_mm512_setzero_ps(), mask, (float *)_src);
 #else
     auto *src = (const typename vfloat16::value_t *)_src;
     return vfloat16(load<vfloat8>(src, vboolf8(mask.vl)),
@@ -262,11 +642,22 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE vuint16 load(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_load_si512((const int *)_src);
+#else
+    auto *src = (const typename vuint16::value_t *)_src;
+    return vuint16(load<vuint8>(src), load<vuint8>(src + 8));
+#endif
+  }
+
   template <>
   TSIMD_INLINE vint16 load(const void *_src, const vboolf16 &mask)
   {
 #if defined(__AVX512F__)
-    return _mm512_mask_load_epi32(_mm512_setzero_epi32(), mask, _src);
+    return _mm512_mask_loadu_epi32(_mm512_setzero_epi32(), mask, _src);
 #else
     auto *src = (const typename vint16::value_t *)_src;
     return vint16(load<vint8>(src, vboolf8(mask.vl)),
@@ -274,4 +665,296 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE vuint16 load(const void *_src, const vboolf16 &mask)
+  {
+#if defined(__AVX512F__)
+    return _mm512_mask_loadu_epi32(_mm512_setzero_epi32(), mask, _src);
+#else
+    auto *src = (const typename vuint16::value_t *)_src;
+    return vuint16(load<vuint8>(src, vboolf8(mask.vl)),
+                   load<vuint8>(src + 8, vboolf8(mask.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vschar16 load(const void *_src)
+  {
+#if defined(__SSE__)
+    return _mm_load_si128((const __m128i *)_src);
+#else
+    auto *src = (const typename vschar16::value_t *)_src;
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vschar16 load(const void *_src, const vboolb16 &mask)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(_mm_load_si128((const __m128i *)_src), mask);
+#else
+    auto *src = (const typename vschar16::value_t *)_src;
+    vschar16 result(0);
+
+    for (int i = 0; i < 16; ++i)
+      if (mask[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar16 load(const void *_src)
+  {
+#if defined(__SSE__)
+    return _mm_load_si128((const __m128i *)_src);
+#else
+    auto *src = (const typename vuchar16::value_t *)_src;
+    vuchar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar16 load(const void *_src, const vboolb16 &mask)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(_mm_load_si128((const __m128i *)_src), mask);
+#else
+    auto *src = (const typename vuchar16::value_t *)_src;
+    vuchar16 result(0);
+
+    for (int i = 0; i < 16; ++i)
+      if (mask[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort16 load(const void *_src)
+  {
+#if defined(__AVX__)
+    return _mm256_load_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vshort16::value_t *)_src;
+    return vshort16(load<vshort8>(src), load<vshort8>(src + 8));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort16 load(const void *_src, const vboolw16 &mask)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(_mm256_load_si256((const __m256i *)_src), mask);
+#else
+    auto *src = (const typename vshort16::value_t *)_src;
+    return vshort16(load<vshort8>(src, vboolw8(mask.vl)),
+                    load<vshort8>(src + 8, vboolw8(mask.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort16 load(const void *_src)
+  {
+#if defined(__AVX__)
+    return _mm256_load_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vushort16::value_t *)_src;
+    return vushort16(load<vushort8>(src), load<vushort8>(src + 8));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort16 load(const void *_src, const vboolw16 &mask)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(_mm256_load_si256((const __m256i *)_src), mask);
+#else
+    auto *src = (const typename vushort16::value_t *)_src;
+    return vushort16(load<vushort8>(src, vboolw8(mask.vl)),
+                     load<vushort8>(src + 8, vboolw8(mask.vh)));
+#endif
+  }
+
+  // 32-wide //
+
+  template <>
+  TSIMD_INLINE vschar32 load(const void *_src)
+  {
+#if defined(__AVX__)
+    return _mm256_load_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vschar32::value_t *)_src;
+    return vschar32(load<vschar16>(src), load<vschar16>(src + 16));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vschar32 load(const void *_src, const vboolb32 &mask)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(_mm256_load_si256((const __m256i *)_src), mask);
+#else
+    auto *src = (const typename vschar32::value_t *)_src;
+    return vschar32(load<vschar16>(src, vboolb16(mask.vl)),
+                    load<vschar16>(src + 16, vboolb16(mask.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar32 load(const void *_src)
+  {
+#if defined(__AVX__)
+    return _mm256_load_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vuchar32::value_t *)_src;
+    return vuchar32(load<vuchar16>(src), load<vuchar16>(src + 16));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar32 load(const void *_src, const vboolb32 &mask)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(_mm256_load_si256((const __m256i *)_src), mask);
+#else
+    auto *src = (const typename vuchar32::value_t *)_src;
+    return vuchar32(load<vuchar16>(src, vboolb16(mask.vl)),
+                    load<vuchar16>(src + 16, vboolb16(mask.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort32 load(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_load_si512(_src);
+#else
+    auto *src = (const typename vshort32::value_t *)_src;
+    return vshort32(load<vshort16>(src), load<vshort16>(src + 16));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort32 load(const void *_src, const vboolw32 &mask)
+  {
+#if defined(__AVX512F__)
+    return _mm512_and_si512(_mm512_load_si512(_src), mask);
+#else
+    auto *src = (const typename vshort32::value_t *)_src;
+    return vshort32(load<vshort16>(src, vboolw16(mask.vl)),
+                    load<vshort16>(src + 16, vboolw16(mask.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort32 load(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_load_si512(_src);
+#else
+    auto *src = (const typename vushort32::value_t *)_src;
+    return vushort32(load<vushort16>(src), load<vushort16>(src + 16));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort32 load(const void *_src, const vboolw32 &mask)
+  {
+#if defined(__AVX512F__)
+    return _mm512_and_si512(_mm512_load_si512(_src), mask);
+#else
+    auto *src = (const typename vushort32::value_t *)_src;
+    return vushort32(load<vushort16>(src, vboolw16(mask.vl)),
+                     load<vushort16>(src + 16, vboolw16(mask.vh)));
+#endif
+  }
+
+  // 64-wide //
+
+  template <>
+  TSIMD_INLINE vschar64 load(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_load_si512(_src);
+#else
+    auto *src = (const typename vschar64::value_t *)_src;
+    return vschar64(load<vschar32>(src), load<vschar32>(src + 32));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vschar64 load(const void *_src, const vboolb64 &mask)
+  {
+#if defined(__AVX512F__)
+    return _mm512_and_si512(_mm512_load_si512(_src), mask);
+#else
+    auto *src = (const typename vschar64::value_t *)_src;
+    return vschar64(load<vschar32>(src, vboolb32(mask.vl)),
+                    load<vschar32>(src + 32, vboolb32(mask.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar64 load(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_load_si512(_src);
+#else
+    auto *src = (const typename vuchar64::value_t *)_src;
+    return vuchar64(load<vuchar32>(src), load<vuchar32>(src + 32));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar64 load(const void *_src, const vboolb64 &mask)
+  {
+#if defined(__AVX512F__)
+    return _mm512_and_si512(_mm512_load_si512(_src), mask);
+#else
+    auto *src = (const typename vuchar64::value_t *)_src;
+    return vuchar64(load<vuchar32>(src, vboolb32(mask.vl)),
+                    load<vuchar32>(src + 32, vboolb32(mask.vh)));
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T load(const void *_src)
+  {
+    using T         = typename PACK_T::value_t;
+    using half_pack = pack<T, PACK_T::static_size / 2>;
+    auto *src = (const T *)_src;
+    return PACK_T(load<half_pack>(src),
+                  load<half_pack>(src + half_pack::static_size));
+  }
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T
+  load(const void *_src,
+       const mask<typename PACK_T::value_t, PACK_T::static_size> &m)
+  {
+    using T         = typename PACK_T::value_t;
+    using half_pack = pack<T, PACK_T::static_size / 2>;
+    using half_mask = mask<T, PACK_T::static_size / 2>;
+    auto *src = (const T *)_src;
+    return PACK_T(
+        load<half_pack>(src, half_mask(m.vl)),
+        load<half_pack>(src + half_pack::static_size, half_mask(m.vh)));
+  }
+
 }  // namespace tsimd
\ No newline at end of file
@@ -0,0 +1,169 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+
+#pragma once
+
+#include "../../bf16_t.h"
+#include "../../pack.h"
+
+namespace tsimd {
+
+  // load_bf16() //////////////////////////////////////////////////////////////
+
+  // NOTE: loads are unaligned, widening is exact (a bf16 is the upper half of
+  //       the float it represents)
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T load_bf16(const bf16_t *src);
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T load_bf16(const bf16_t *src,
+                                const mask_for_pack_t<PACK_T> &m);
+
+  // 1-wide //
+
+  template <>
+  TSIMD_INLINE vfloat1 load_bf16(const bf16_t *src)
+  {
+    return vfloat1(detail::bf16_to_float(src->bits));
+  }
+
+  template <>
+  TSIMD_INLINE vfloat1 load_bf16(const bf16_t *src, const vboolf1 &mask)
+  {
+    return vfloat1(mask[0] ? detail::bf16_to_float(src->bits) : 0.f);
+  }
+
+  // 4-wide //
+
+  template <>
+  TSIMD_INLINE vfloat4 load_bf16(const bf16_t *src)
+  {
+#if defined(__SSE__)
+    return _mm_castsi128_ps(_mm_unpacklo_epi16(
+        _mm_setzero_si128(), _mm_loadl_epi64((const __m128i *)src)));
+#else
+    vfloat4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = detail::bf16_to_float(src[i].bits);
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat4 load_bf16(const bf16_t *src, const vboolf4 &mask)
+  {
+#if defined(__AVX512VL__)
+    return _mm_maskz_mov_ps(mask, load_bf16<vfloat4>(src));
+#elif defined(__SSE__)
+    return _mm_and_ps(load_bf16<vfloat4>(src), mask);
+#else
+    vfloat4 result(0.f);
+
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        result[i] = detail::bf16_to_float(src[i].bits);
+
+    return result;
+#endif
+  }
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE vfloat8 load_bf16(const bf16_t *src)
+  {
+#if defined(__AVX2__)
+    return _mm256_castsi256_ps(_mm256_slli_epi32(
+        _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)src)), 16));
+#else
+    return vfloat8(load_bf16<vfloat4>(src), load_bf16<vfloat4>(src + 4));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat8 load_bf16(const bf16_t *src, const vboolf8 &mask)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_maskz_mov_ps(mask, load_bf16<vfloat8>(src));
+#elif defined(__AVX2__)
+    return _mm256_and_ps(load_bf16<vfloat8>(src), mask);
+#else
+    return vfloat8(load_bf16<vfloat4>(src, vboolf4(mask.vl)),
+                   load_bf16<vfloat4>(src + 4, vboolf4(mask.vh)));
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE vfloat16 load_bf16(const bf16_t *src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_castsi512_ps(_mm512_slli_epi32(
+        _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)src)), 16));
+#else
+    return vfloat16(load_bf16<vfloat8>(src), load_bf16<vfloat8>(src + 8));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat16 load_bf16(const bf16_t *src, const vboolf16 &mask)
+  {
+#if defined(__AVX512F__)
+    return _mm512_castsi512_ps(_mm512_slli_epi32(
+        _mm512_maskz_cvtepu16_epi32(mask,
+                                    _mm256_loadu_si256((const __m256i *)src)),
+        16));
+#else
+    return vfloat16(load_bf16<vfloat8>(src, vboolf8(mask.vl)),
+                    load_bf16<vfloat8>(src + 8, vboolf8(mask.vh)));
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T load_bf16(const bf16_t *src)
+  {
+    using half_pack = vfloatn<PACK_T::static_size / 2>;
+    return PACK_T(load_bf16<half_pack>(src),
+                  load_bf16<half_pack>(src + half_pack::static_size));
+  }
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T load_bf16(const bf16_t *src,
+                                const mask_for_pack_t<PACK_T> &m)
+  {
+    using half_pack = vfloatn<PACK_T::static_size / 2>;
+    using half_mask = vboolfn<PACK_T::static_size / 2>;
+    return PACK_T(
+        load_bf16<half_pack>(src, half_mask(m.vl)),
+        load_bf16<half_pack>(src + half_pack::static_size, half_mask(m.vh)));
+  }
+
+}  // namespace tsimd
@@ -0,0 +1,196 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+
+#pragma once
+
+#include "../../half_t.h"
+#include "../../pack.h"
+
+namespace tsimd {
+
+  // load_half() //////////////////////////////////////////////////////////////
+
+  // NOTE: loads are unaligned, packed half_t arrays are rarely vector aligned
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T load_half(const half_t *src);
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T load_half(const half_t *src,
+                                const mask_for_pack_t<PACK_T> &m);
+
+  // 1-wide //
+
+  template <>
+  TSIMD_INLINE vfloat1 load_half(const half_t *src)
+  {
+    return vfloat1(detail::half_to_float(src->bits));
+  }
+
+  template <>
+  TSIMD_INLINE vfloat1 load_half(const half_t *src, const vboolf1 &mask)
+  {
+    return vfloat1(mask[0] ? detail::half_to_float(src->bits) : 0.f);
+  }
+
+  // 4-wide //
+
+  template <>
+  TSIMD_INLINE vfloat4 load_half(const half_t *src)
+  {
+#if defined(__F16C__)
+    return _mm_cvtph_ps(_mm_loadl_epi64((const __m128i *)src));
+#else
+    vfloat4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = detail::half_to_float(src[i].bits);
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat4 load_half(const half_t *src, const vboolf4 &mask)
+  {
+#if defined(__AVX512VL__)
+    return _mm_maskz_cvtph_ps(mask, _mm_loadl_epi64((const __m128i *)src));
+#elif defined(__F16C__)
+    return _mm_and_ps(_mm_cvtph_ps(_mm_loadl_epi64((const __m128i *)src)),
+                      mask);
+#else
+    vfloat4 result(0.f);
+
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        result[i] = detail::half_to_float(src[i].bits);
+
+    return result;
+#endif
+  }
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE vfloat8 load_half(const half_t *src)
+  {
+#if defined(__F16C__)
+    return _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)src));
+#else
+    return vfloat8(load_half<vfloat4>(src), load_half<vfloat4>(src + 4));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat8 load_half(const half_t *src, const vboolf8 &mask)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_maskz_cvtph_ps(mask,
+                                  _mm_loadu_si128((const __m128i *)src));
+#elif defined(__F16C__)
+    return _mm256_and_ps(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)src)),
+                         mask);
+#else
+    return vfloat8(load_half<vfloat4>(src, vboolf4(mask.vl)),
+                   load_half<vfloat4>(src + 4, vboolf4(mask.vh)));
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE vfloat16 load_half(const half_t *src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)src));
+#else
+    return vfloat16(load_half<vfloat8>(src), load_half<vfloat8>(src + 8));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat16 load_half(const half_t *src, const vboolf16 &mask)
+  {
+#if defined(__AVX512F__)
+    return _mm512_maskz_cvtph_ps(mask,
+                                 _mm256_loadu_si256((const __m256i *)src));
+#else
+    return vfloat16(load_half<vfloat8>(src, vboolf8(mask.vl)),
+                    load_half<vfloat8>(src + 8, vboolf8(mask.vh)));
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T load_half(const half_t *src)
+  {
+    using half_pack = vfloatn<PACK_T::static_size / 2>;
+    return PACK_T(load_half<half_pack>(src),
+                  load_half<half_pack>(src + half_pack::static_size));
+  }
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T load_half(const half_t *src,
+                                const mask_for_pack_t<PACK_T> &m)
+  {
+    using half_pack = vfloatn<PACK_T::static_size / 2>;
+    using half_mask = vboolfn<PACK_T::static_size / 2>;
+    return PACK_T(
+        load_half<half_pack>(src, half_mask(m.vl)),
+        load_half<half_pack>(src + half_pack::static_size, half_mask(m.vh)));
+  }
+
+  // gather_half() ////////////////////////////////////////////////////////////
+
+  // NOTE: there is no 16-bit hardware gather, so the halves are collected
+  //       into a packed buffer and converted together
+
+  template <typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE PACK_T
+  gather_half(const half_t *src, const pack<OFFSET_T, PACK_T::static_size> &o)
+  {
+    half_t tmp[PACK_T::static_size];
+
+    for (int i = 0; i < PACK_T::static_size; ++i)
+      tmp[i] = src[o[i]];
+
+    return load_half<PACK_T>(tmp);
+  }
+
+  template <typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE PACK_T gather_half(const half_t *src,
+                                  const pack<OFFSET_T, PACK_T::static_size> &o,
+                                  const mask_for_pack_t<PACK_T> &m)
+  {
+    half_t tmp[PACK_T::static_size];
+
+    for (int i = 0; i < PACK_T::static_size; ++i)
+      tmp[i].bits = m[i] ? src[o[i]].bits : 0;
+
+    return load_half<PACK_T>(tmp);
+  }
+
+}  // namespace tsimd
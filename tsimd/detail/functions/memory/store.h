@@ -49,12 +49,74 @@ namespace tsimd {
   }
 
   template <typename T>
-  TSIMD_INLINE void store(const pack<T, 1> &v, void *_dst, const vboolf1 &mask)
+  TSIMD_INLINE void store(const pack<T, 1> &v,
+                          void *_dst,
+                          const mask<T, 1> &mask)
   {
     if (mask[0])
       *((T *)_dst) = v[0];
   }
 
+  // 2-wide //
+
+  template <>
+  TSIMD_INLINE void store(const vdouble2 &v, void *_dst)
+  {
+#if defined(__SSE__)
+    _mm_store_pd((double *)_dst, v);
+#else
+    auto *dst = (typename vdouble2::value_t *)_dst;
+
+    for (int i = 0; i < 2; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vdouble2 &v, void *_dst, const vboold2 &mask)
+  {
+#if defined(__AVX512VL__)
+    _mm_mask_storeu_pd((double *)_dst, mask, v);
+#elif defined(__AVX__)
+    _mm_maskstore_pd((double *)_dst, mask, v);
+#else
+    auto *dst = (typename vdouble2::value_t *)_dst;
+
+    for (int i = 0; i < 2; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vllong2 &v, void *_dst)
+  {
+#if defined(__SSE__)
+    _mm_store_si128((__m128i *)_dst, v);
+#else
+    auto *dst = (typename vllong2::value_t *)_dst;
+
+    for (int i = 0; i < 2; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vllong2 &v, void *_dst, const vboold2 &mask)
+  {
+#if defined(__AVX512VL__)
+    _mm_mask_storeu_epi64(_dst, mask, v);
+#elif defined(__AVX__)
+    _mm_maskstore_pd((double *)_dst, mask, _mm_castsi128_pd(v));
+#else
+    auto *dst = (typename vllong2::value_t *)_dst;
+
+    for (int i = 0; i < 2; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
   // 4-wide //
 
   // TODO
@@ -75,7 +137,9 @@ namespace tsimd {
   template <>
   TSIMD_INLINE void store(const vfloat4 &v, void *_dst, const vboolf4 &mask)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    _mm_mask_storeu_ps((float *)_dst, mask, v);
+#elif defined(__SSE__)
     store(select(mask, v, load<vfloat4>(_dst)), _dst);
 #else
     auto *dst = (typename vfloat4::value_t *)_dst;
@@ -100,9 +164,24 @@ namespace tsimd {
   }
 
   template <>
-  TSIMD_INLINE void store(const vint4 &v, void *_dst, const vboolf4 &mask)
+  TSIMD_INLINE void store(const vuint4 &v, void *_dst)
   {
 #if defined(__SSE__)
+    _mm_store_si128((__m128i *)_dst, v);
+#else
+    auto *dst = (typename vuint4::value_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vint4 &v, void *_dst, const vboolf4 &mask)
+  {
+#if defined(__AVX512VL__)
+    _mm_mask_storeu_epi32(_dst, mask, v);
+#elif defined(__SSE__)
     store(select(mask, v, load<vint4>(_dst)), _dst);
 #else
     auto *dst = (typename vint4::value_t *)_dst;
@@ -113,6 +192,82 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE void store(const vuint4 &v, void *_dst, const vboolf4 &mask)
+  {
+#if defined(__AVX512VL__)
+    _mm_mask_storeu_epi32(_dst, mask, v);
+#elif defined(__SSE__)
+    store(select(mask, v, load<vuint4>(_dst)), _dst);
+#else
+    auto *dst = (typename vuint4::value_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vdouble4 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_store_pd((double *)_dst, v);
+#else
+    auto *dst = (typename vdouble4::value_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vdouble4 &v, void *_dst, const vboold4 &mask)
+  {
+#if defined(__AVX512VL__)
+    _mm256_mask_storeu_pd((double *)_dst, mask, v);
+#elif defined(__AVX__)
+    _mm256_maskstore_pd((double *)_dst, mask, v);
+#else
+    auto *dst = (typename vdouble4::value_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vllong4 &v, void *_dst)
+  {
+#if defined(__AVX2__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#elif defined(__AVX__)
+    _mm256_store_pd((double *)_dst, v);
+#else
+    auto *dst = (typename vllong4::value_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vllong4 &v, void *_dst, const vboold4 &mask)
+  {
+#if defined(__AVX512VL__)
+    _mm256_mask_storeu_epi64(_dst, mask, v);
+#elif defined(__AVX__)
+    _mm256_maskstore_pd((double *)_dst, mask, v);
+#else
+    auto *dst = (typename vllong4::value_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
   // 8-wide //
 
   template <>
@@ -130,7 +285,9 @@ namespace tsimd {
   template <>
   TSIMD_INLINE void store(const vfloat8 &v, void *_dst, const vboolf8 &mask)
   {
-#if defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    _mm256_mask_storeu_ps((float *)_dst, mask, v);
+#elif defined(__AVX2__) || defined(__AVX__)
     _mm256_maskstore_ps((float *)_dst, mask, v);
 #else
     auto *dst = (typename vfloat8::value_t *)_dst;
@@ -153,10 +310,26 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE void store(const vuint8 &v, void *_dst)
+  {
+#if defined(__AVX2__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#elif defined(__AVX__)
+    _mm256_store_ps((float *)_dst, v);
+#else
+    auto *dst = (typename vuint8::value_t *)_dst;
+    store(vuint4(v.vl), dst);
+    store(vuint4(v.vh), dst + 4);
+#endif
+  }
+
   template <>
   TSIMD_INLINE void store(const vint8 &v, void *_dst, const vboolf8 &mask)
   {
-#if 0  // defined(__AVX2__)
+#if defined(__AVX512VL__)
+    _mm256_mask_storeu_epi32(_dst, mask, v);
+#elif 0  // defined(__AVX2__)
     _mm256_maskstore_epi32((int*)_dst, mask, v);
 #elif defined(__AVX__)
     _mm256_maskstore_ps((float *)_dst, mask, v);
@@ -167,6 +340,124 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE void store(const vuint8 &v, void *_dst, const vboolf8 &mask)
+  {
+#if defined(__AVX512VL__)
+    _mm256_mask_storeu_epi32(_dst, mask, v);
+#elif 0  // defined(__AVX2__)
+    _mm256_maskstore_epi32((int*)_dst, mask, v);
+#elif defined(__AVX__)
+    _mm256_maskstore_ps((float *)_dst, mask, v);
+#else
+    auto *dst = (typename vuint8::value_t *)_dst;
+    store(vuint4(v.vl), dst, vboolf4(mask.vl));
+    store(vuint4(v.vh), dst + 4, vboolf4(mask.vh));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vdouble8 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_store_pd((double *)_dst, v);
+#else
+    auto *dst = (typename vdouble8::value_t *)_dst;
+    store(vdouble4(v.vl), dst);
+    store(vdouble4(v.vh), dst + 4);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vdouble8 &v, void *_dst, const vboold8 &mask)
+  {
+#if defined(__AVX512F__)
+    _mm512_mask_storeu_pd((double *)_dst, mask, v);
+#else
+    auto *dst = (typename vdouble8::value_t *)_dst;
+    store(vdouble4(v.vl), dst, vboold4(mask.vl));
+    store(vdouble4(v.vh), dst + 4, vboold4(mask.vh));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vllong8 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_store_si512(_dst, v);
+#else
+    auto *dst = (typename vllong8::value_t *)_dst;
+    store(vllong4(v.vl), dst);
+    store(vllong4(v.vh), dst + 4);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vllong8 &v, void *_dst, const vboold8 &mask)
+  {
+#if defined(__AVX512F__)
+    _mm512_mask_storeu_epi64(_dst, mask, v);
+#else
+    auto *dst = (typename vllong8::value_t *)_dst;
+    store(vllong4(v.vl), dst, vboold4(mask.vl));
+    store(vllong4(v.vh), dst + 4, vboold4(mask.vh));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort8 &v, void *_dst)
+  {
+#if defined(__SSE__)
+    _mm_store_si128((__m128i *)_dst, v);
+#else
+    auto *dst = (typename vshort8::value_t *)_dst;
+
+    for (int i = 0; i < 8; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort8 &v, void *_dst, const vboolw8 &mask)
+  {
+#if defined(__SSE__)
+    _mm_maskmoveu_si128(v, mask, (char *)_dst);
+#else
+    auto *dst = (typename vshort8::value_t *)_dst;
+
+    for (int i = 0; i < 8; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort8 &v, void *_dst)
+  {
+#if defined(__SSE__)
+    _mm_store_si128((__m128i *)_dst, v);
+#else
+    auto *dst = (typename vushort8::value_t *)_dst;
+
+    for (int i = 0; i < 8; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort8 &v, void *_dst, const vboolw8 &mask)
+  {
+#if defined(__SSE__)
+    _mm_maskmoveu_si128(v, mask, (char *)_dst);
+#else
+    auto *dst = (typename vushort8::value_t *)_dst;
+
+    for (int i = 0; i < 8; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
   // 16-wide //
 
   template <>
@@ -185,7 +476,7 @@ namespace tsimd {
   TSIMD_INLINE void store(const vfloat16 &v, void *_dst, const vboolf16 &mask)
   {
 #if defined(__AVX512F__)
-    _mm512_mask_store_ps((float *)_dst, mask, v);
+    _mm512_mask_storeu_ps((float *)_dst, mask, v);
 #else
     auto *dst = (typename vfloat16::value_t *)_dst;
     store(vfloat8(v.vl), dst, vboolf8(mask.vl));
@@ -205,11 +496,23 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE void store(const vuint16 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_store_si512(_dst, v);
+#else
+    auto *dst = (typename vuint16::value_t *)_dst;
+    store(vuint8(v.vl), dst);
+    store(vuint8(v.vh), dst + 8);
+#endif
+  }
+
   template <>
   TSIMD_INLINE void store(const vint16 &v, void *_dst, const vboolf16 &mask)
   {
 #if defined(__AVX512F__)
-    _mm512_mask_store_epi32(_dst, mask, v);
+    _mm512_mask_storeu_epi32(_dst, mask, v);
 #else
     auto *dst = (typename vint16::value_t *)_dst;
     store(vint8(v.vl), dst, vboolf8(mask.vl));
@@ -217,4 +520,276 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE void store(const vuint16 &v, void *_dst, const vboolf16 &mask)
+  {
+#if defined(__AVX512F__)
+    _mm512_mask_storeu_epi32(_dst, mask, v);
+#else
+    auto *dst = (typename vuint16::value_t *)_dst;
+    store(vuint8(v.vl), dst, vboolf8(mask.vl));
+    store(vuint8(v.vh), dst + 8, vboolf8(mask.vh));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vschar16 &v, void *_dst)
+  {
+#if defined(__SSE__)
+    _mm_store_si128((__m128i *)_dst, v);
+#else
+    auto *dst = (typename vschar16::value_t *)_dst;
+
+    for (int i = 0; i < 16; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vschar16 &v, void *_dst, const vboolb16 &mask)
+  {
+#if defined(__SSE__)
+    _mm_maskmoveu_si128(v, mask, (char *)_dst);
+#else
+    auto *dst = (typename vschar16::value_t *)_dst;
+
+    for (int i = 0; i < 16; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar16 &v, void *_dst)
+  {
+#if defined(__SSE__)
+    _mm_store_si128((__m128i *)_dst, v);
+#else
+    auto *dst = (typename vuchar16::value_t *)_dst;
+
+    for (int i = 0; i < 16; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar16 &v, void *_dst, const vboolb16 &mask)
+  {
+#if defined(__SSE__)
+    _mm_maskmoveu_si128(v, mask, (char *)_dst);
+#else
+    auto *dst = (typename vuchar16::value_t *)_dst;
+
+    for (int i = 0; i < 16; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort16 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vshort16::value_t *)_dst;
+    store(vshort8(v.vl), dst);
+    store(vshort8(v.vh), dst + 8);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort16 &v, void *_dst, const vboolw16 &mask)
+  {
+    auto *dst = (typename vshort16::value_t *)_dst;
+    store(vshort8(v.vl), dst, vboolw8(mask.vl));
+    store(vshort8(v.vh), dst + 8, vboolw8(mask.vh));
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort16 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vushort16::value_t *)_dst;
+    store(vushort8(v.vl), dst);
+    store(vushort8(v.vh), dst + 8);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort16 &v, void *_dst, const vboolw16 &mask)
+  {
+    auto *dst = (typename vushort16::value_t *)_dst;
+    store(vushort8(v.vl), dst, vboolw8(mask.vl));
+    store(vushort8(v.vh), dst + 8, vboolw8(mask.vh));
+  }
+
+  // 32-wide //
+
+  template <>
+  TSIMD_INLINE void store(const vschar32 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vschar32::value_t *)_dst;
+    store(vschar16(v.vl), dst);
+    store(vschar16(v.vh), dst + 16);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vschar32 &v, void *_dst, const vboolb32 &mask)
+  {
+    auto *dst = (typename vschar32::value_t *)_dst;
+    store(vschar16(v.vl), dst, vboolb16(mask.vl));
+    store(vschar16(v.vh), dst + 16, vboolb16(mask.vh));
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar32 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vuchar32::value_t *)_dst;
+    store(vuchar16(v.vl), dst);
+    store(vuchar16(v.vh), dst + 16);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar32 &v, void *_dst, const vboolb32 &mask)
+  {
+    auto *dst = (typename vuchar32::value_t *)_dst;
+    store(vuchar16(v.vl), dst, vboolb16(mask.vl));
+    store(vuchar16(v.vh), dst + 16, vboolb16(mask.vh));
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort32 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_store_si512(_dst, v);
+#else
+    auto *dst = (typename vshort32::value_t *)_dst;
+    store(vshort16(v.vl), dst);
+    store(vshort16(v.vh), dst + 16);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort32 &v, void *_dst, const vboolw32 &mask)
+  {
+#if defined(__AVX512BW__)
+    _mm512_mask_storeu_epi16(_dst, _mm512_movepi16_mask(mask), v);
+#else
+    auto *dst = (typename vshort32::value_t *)_dst;
+    store(vshort16(v.vl), dst, vboolw16(mask.vl));
+    store(vshort16(v.vh), dst + 16, vboolw16(mask.vh));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort32 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_store_si512(_dst, v);
+#else
+    auto *dst = (typename vushort32::value_t *)_dst;
+    store(vushort16(v.vl), dst);
+    store(vushort16(v.vh), dst + 16);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort32 &v, void *_dst, const vboolw32 &mask)
+  {
+#if defined(__AVX512BW__)
+    _mm512_mask_storeu_epi16(_dst, _mm512_movepi16_mask(mask), v);
+#else
+    auto *dst = (typename vushort32::value_t *)_dst;
+    store(vushort16(v.vl), dst, vboolw16(mask.vl));
+    store(vushort16(v.vh), dst + 16, vboolw16(mask.vh));
+#endif
+  }
+
+  // 64-wide //
+
+  template <>
+  TSIMD_INLINE void store(const vschar64 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_store_si512(_dst, v);
+#else
+    auto *dst = (typename vschar64::value_t *)_dst;
+    store(vschar32(v.vl), dst);
+    store(vschar32(v.vh), dst + 32);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vschar64 &v, void *_dst, const vboolb64 &mask)
+  {
+#if defined(__AVX512BW__)
+    _mm512_mask_storeu_epi8(_dst, _mm512_movepi8_mask(mask), v);
+#else
+    auto *dst = (typename vschar64::value_t *)_dst;
+    store(vschar32(v.vl), dst, vboolb32(mask.vl));
+    store(vschar32(v.vh), dst + 32, vboolb32(mask.vh));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar64 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_store_si512(_dst, v);
+#else
+    auto *dst = (typename vuchar64::value_t *)_dst;
+    store(vuchar32(v.vl), dst);
+    store(vuchar32(v.vh), dst + 32);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar64 &v, void *_dst, const vboolb64 &mask)
+  {
+#if defined(__AVX512BW__)
+    _mm512_mask_storeu_epi8(_dst, _mm512_movepi8_mask(mask), v);
+#else
+    auto *dst = (typename vuchar64::value_t *)_dst;
+    store(vuchar32(v.vl), dst, vboolb32(mask.vl));
+    store(vuchar32(v.vh), dst + 32, vboolb32(mask.vh));
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename PACK_T>
+  TSIMD_INLINE void store(const PACK_T &p, void *_dst)
+  {
+    using T         = typename PACK_T::value_t;
+    using half_pack = pack<T, PACK_T::static_size / 2>;
+    auto *dst = (T *)_dst;
+    store(half_pack(p.vl), dst);
+    store(half_pack(p.vh), dst + half_pack::static_size);
+  }
+
+  template <typename PACK_T>
+  TSIMD_INLINE void store(
+      const PACK_T &p,
+      void *_dst,
+      const mask<typename PACK_T::value_t, PACK_T::static_size> &m)
+  {
+    using T         = typename PACK_T::value_t;
+    using half_pack = pack<T, PACK_T::static_size / 2>;
+    using half_mask = mask<T, PACK_T::static_size / 2>;
+    auto *dst = (T *)_dst;
+    store(half_pack(p.vl), dst, half_mask(m.vl));
+    store(half_pack(p.vh), dst + half_pack::static_size, half_mask(m.vh));
+  }
+
 }  // namespace tsimd
\ No newline at end of file
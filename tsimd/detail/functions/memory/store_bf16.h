@@ -0,0 +1,254 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+
+#pragma once
+
+#include "../../bf16_t.h"
+#include "../../pack.h"
+
+namespace tsimd {
+
+  // Packed float --> bf16 narrowing //////////////////////////////////////////
+
+  // NOTE: round-to-nearest-even, NaNs are truncated and made quiet (same as
+  //       detail::float_to_bf16()); the AVX512BF16 instructions additionally
+  //       flush denormals to zero
+
+  namespace detail {
+
+#if defined(__SSE__)
+    // 4 x bf16 in the low 64 bits
+    TSIMD_INLINE __m128i cvt_bf16(const vfloat4 &v)
+    {
+#  if defined(__AVX512BF16__) && defined(__AVX512VL__)
+      return (__m128i)_mm_cvtneps_pbh(v);
+#  else
+      const __m128i x   = _mm_castps_si128(v);
+      const __m128i lsb = _mm_and_si128(_mm_srli_epi32(x, 16),
+                                        _mm_set1_epi32(1));
+      const __m128i r   = _mm_srli_epi32(
+          _mm_add_epi32(x, _mm_add_epi32(lsb, _mm_set1_epi32(0x7fff))), 16);
+      const __m128i q =
+          _mm_or_si128(_mm_srli_epi32(x, 16), _mm_set1_epi32(0x40));
+      const __m128i nan = _mm_castps_si128(_mm_cmpunord_ps(v, v));
+
+      __m128i result =
+          _mm_or_si128(_mm_and_si128(nan, q), _mm_andnot_si128(nan, r));
+
+      // sign-extend so the saturating pack keeps all 16 bits
+      result = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+      return _mm_packs_epi32(result, result);
+#  endif
+    }
+
+    // 8 x bf16
+    TSIMD_INLINE __m128i cvt_bf16(const vfloat8 &v)
+    {
+#  if defined(__AVX512BF16__) && defined(__AVX512VL__)
+      return (__m128i)_mm256_cvtneps_pbh(v);
+#  elif defined(__AVX2__)
+      const __m256i x   = _mm256_castps_si256(v);
+      const __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(x, 16),
+                                           _mm256_set1_epi32(1));
+      const __m256i r   = _mm256_srli_epi32(
+          _mm256_add_epi32(x, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7fff))),
+          16);
+      const __m256i q =
+          _mm256_or_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(0x40));
+      const __m256i nan =
+          _mm256_castps_si256(_mm256_cmp_ps(v, v, _CMP_UNORD_Q));
+
+      const __m256i result = _mm256_blendv_epi8(r, q, nan);
+
+      return _mm256_castsi256_si128(_mm256_permute4x64_epi64(
+          _mm256_packus_epi32(result, result), 0x08));
+#  else
+      return _mm_unpacklo_epi64(cvt_bf16(vfloat4(v.vl)),
+                                cvt_bf16(vfloat4(v.vh)));
+#  endif
+    }
+#endif
+
+#if defined(__AVX512F__)
+    // 16 x bf16
+    TSIMD_INLINE __m256i cvt_bf16(const vfloat16 &v)
+    {
+#  if defined(__AVX512BF16__)
+      return (__m256i)_mm512_cvtneps_pbh(v);
+#  else
+      const __m512i x   = _mm512_castps_si512(v);
+      const __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(x, 16),
+                                           _mm512_set1_epi32(1));
+      const __m512i r   = _mm512_srli_epi32(
+          _mm512_add_epi32(x, _mm512_add_epi32(lsb, _mm512_set1_epi32(0x7fff))),
+          16);
+      const __m512i q =
+          _mm512_or_si512(_mm512_srli_epi32(x, 16), _mm512_set1_epi32(0x40));
+      const __mmask16 nan = _mm512_cmp_ps_mask(v, v, _CMP_UNORD_Q);
+
+      return _mm512_cvtepi32_epi16(_mm512_mask_blend_epi32(nan, r, q));
+#  endif
+    }
+#endif
+
+  }  // namespace detail
+
+  // store_bf16() /////////////////////////////////////////////////////////////
+
+  // NOTE: stores are unaligned, masked stores never touch inactive elements
+
+  // 1-wide //
+
+  TSIMD_INLINE void store_bf16(const vfloat1 &v, bf16_t *dst)
+  {
+    dst->bits = detail::float_to_bf16(v[0]);
+  }
+
+  TSIMD_INLINE void store_bf16(const vfloat1 &v,
+                               bf16_t *dst,
+                               const vboolf1 &mask)
+  {
+    if (mask[0])
+      dst->bits = detail::float_to_bf16(v[0]);
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE void store_bf16(const vfloat4 &v, bf16_t *dst)
+  {
+#if defined(__SSE__)
+    _mm_storel_epi64((__m128i *)dst, detail::cvt_bf16(v));
+#else
+    for (int i = 0; i < 4; ++i)
+      dst[i].bits = detail::float_to_bf16(v[i]);
+#endif
+  }
+
+  TSIMD_INLINE void store_bf16(const vfloat4 &v,
+                               bf16_t *dst,
+                               const vboolf4 &mask)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    _mm_mask_storeu_epi16(dst, mask, detail::cvt_bf16(v));
+#elif defined(__AVX512VL__)
+    const __m128i m = _mm_cvtepi32_epi16(_mm_maskz_set1_epi32(mask, -1));
+    _mm_maskmoveu_si128(detail::cvt_bf16(v), m, (char *)dst);
+#elif defined(__SSE__)
+    // narrow the mask to 16-bit lanes, the upper 4 lanes are never written
+    const __m128i m =
+        _mm_packs_epi32(_mm_castps_si128(mask), _mm_setzero_si128());
+    _mm_maskmoveu_si128(detail::cvt_bf16(v), m, (char *)dst);
+#else
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        dst[i].bits = detail::float_to_bf16(v[i]);
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE void store_bf16(const vfloat8 &v, bf16_t *dst)
+  {
+#if defined(__SSE__)
+    _mm_storeu_si128((__m128i *)dst, detail::cvt_bf16(v));
+#else
+    store_bf16(vfloat4(v.vl), dst);
+    store_bf16(vfloat4(v.vh), dst + 4);
+#endif
+  }
+
+  TSIMD_INLINE void store_bf16(const vfloat8 &v,
+                               bf16_t *dst,
+                               const vboolf8 &mask)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    _mm_mask_storeu_epi16(dst, mask, detail::cvt_bf16(v));
+#elif defined(__AVX512VL__)
+    const __m128i m =
+        _mm256_cvtepi32_epi16(_mm256_maskz_set1_epi32(mask, -1));
+    _mm_maskmoveu_si128(detail::cvt_bf16(v), m, (char *)dst);
+#elif defined(__AVX__)
+    const __m128i m = _mm_packs_epi32(
+        _mm_castps_si128(_mm256_castps256_ps128(mask)),
+        _mm_castps_si128(_mm256_extractf128_ps(mask, 1)));
+    _mm_maskmoveu_si128(detail::cvt_bf16(v), m, (char *)dst);
+#else
+    store_bf16(vfloat4(v.vl), dst, vboolf4(mask.vl));
+    store_bf16(vfloat4(v.vh), dst + 4, vboolf4(mask.vh));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE void store_bf16(const vfloat16 &v, bf16_t *dst)
+  {
+#if defined(__AVX512F__)
+    _mm256_storeu_si256((__m256i *)dst, detail::cvt_bf16(v));
+#else
+    store_bf16(vfloat8(v.vl), dst);
+    store_bf16(vfloat8(v.vh), dst + 8);
+#endif
+  }
+
+  TSIMD_INLINE void store_bf16(const vfloat16 &v,
+                               bf16_t *dst,
+                               const vboolf16 &mask)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    _mm256_mask_storeu_epi16(dst, mask, detail::cvt_bf16(v));
+#elif defined(__AVX512F__)
+    const __m256i h = detail::cvt_bf16(v);
+    const __m256i m =
+        _mm512_cvtepi32_epi16(_mm512_maskz_set1_epi32(mask, -1));
+    _mm_maskmoveu_si128(
+        _mm256_castsi256_si128(h), _mm256_castsi256_si128(m), (char *)dst);
+    _mm_maskmoveu_si128(_mm256_extracti128_si256(h, 1),
+                        _mm256_extracti128_si256(m, 1),
+                        (char *)(dst + 8));
+#else
+    store_bf16(vfloat8(v.vl), dst, vboolf8(mask.vl));
+    store_bf16(vfloat8(v.vh), dst + 8, vboolf8(mask.vh));
+#endif
+  }
+
+  // Composite widths //
+
+  template <int W, typename = traits::has_halves_t<W>>
+  TSIMD_INLINE void store_bf16(const vfloatn<W> &v, bf16_t *dst)
+  {
+    store_bf16(vfloatn<W / 2>(v.vl), dst);
+    store_bf16(vfloatn<W / 2>(v.vh), dst + W / 2);
+  }
+
+  template <int W, typename = traits::has_halves_t<W>>
+  TSIMD_INLINE void store_bf16(const vfloatn<W> &v,
+                               bf16_t *dst,
+                               const vboolfn<W> &mask)
+  {
+    store_bf16(vfloatn<W / 2>(v.vl), dst, vboolfn<W / 2>(mask.vl));
+    store_bf16(vfloatn<W / 2>(v.vh), dst + W / 2, vboolfn<W / 2>(mask.vh));
+  }
+
+}  // namespace tsimd
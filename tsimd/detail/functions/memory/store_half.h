@@ -0,0 +1,182 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+
+#pragma once
+
+#include "../../half_t.h"
+#include "../../pack.h"
+
+namespace tsimd {
+
+  // store_half() /////////////////////////////////////////////////////////////
+
+  // NOTE: stores are unaligned, the rounding mode must be a compile-time
+  //       constant as it is encoded in the conversion instruction
+
+  // 1-wide //
+
+  template <half_rounding R = half_rounding::nearest>
+  TSIMD_INLINE void store_half(const vfloat1 &v, half_t *dst)
+  {
+    dst->bits = detail::float_to_half(v[0], R);
+  }
+
+  template <half_rounding R = half_rounding::nearest>
+  TSIMD_INLINE void store_half(const vfloat1 &v,
+                               half_t *dst,
+                               const vboolf1 &mask)
+  {
+    if (mask[0])
+      dst->bits = detail::float_to_half(v[0], R);
+  }
+
+  // 4-wide //
+
+  template <half_rounding R = half_rounding::nearest>
+  TSIMD_INLINE void store_half(const vfloat4 &v, half_t *dst)
+  {
+#if defined(__F16C__)
+    _mm_storel_epi64((__m128i *)dst, _mm_cvtps_ph(v, int(R)));
+#else
+    for (int i = 0; i < 4; ++i)
+      dst[i].bits = detail::float_to_half(v[i], R);
+#endif
+  }
+
+  template <half_rounding R = half_rounding::nearest>
+  TSIMD_INLINE void store_half(const vfloat4 &v,
+                               half_t *dst,
+                               const vboolf4 &mask)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    _mm_mask_storeu_epi16(dst, mask, _mm_cvtps_ph(v, int(R)));
+#elif defined(__AVX512VL__)
+    const __m128i m = _mm_cvtepi32_epi16(_mm_maskz_set1_epi32(mask, -1));
+    _mm_maskmoveu_si128(_mm_cvtps_ph(v, int(R)), m, (char *)dst);
+#elif defined(__F16C__)
+    // narrow the mask to 16-bit lanes, the upper 4 lanes are never written
+    const __m128i m =
+        _mm_packs_epi32(_mm_castps_si128(mask), _mm_setzero_si128());
+    _mm_maskmoveu_si128(_mm_cvtps_ph(v, int(R)), m, (char *)dst);
+#else
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        dst[i].bits = detail::float_to_half(v[i], R);
+#endif
+  }
+
+  // 8-wide //
+
+  template <half_rounding R = half_rounding::nearest>
+  TSIMD_INLINE void store_half(const vfloat8 &v, half_t *dst)
+  {
+#if defined(__F16C__)
+    _mm_storeu_si128((__m128i *)dst, _mm256_cvtps_ph(v, int(R)));
+#else
+    store_half<R>(vfloat4(v.vl), dst);
+    store_half<R>(vfloat4(v.vh), dst + 4);
+#endif
+  }
+
+  template <half_rounding R = half_rounding::nearest>
+  TSIMD_INLINE void store_half(const vfloat8 &v,
+                               half_t *dst,
+                               const vboolf8 &mask)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    _mm_mask_storeu_epi16(dst, mask, _mm256_cvtps_ph(v, int(R)));
+#elif defined(__AVX512VL__)
+    const __m128i m =
+        _mm256_cvtepi32_epi16(_mm256_maskz_set1_epi32(mask, -1));
+    _mm_maskmoveu_si128(_mm256_cvtps_ph(v, int(R)), m, (char *)dst);
+#elif defined(__F16C__)
+    const __m128i m = _mm_packs_epi32(
+        _mm_castps_si128(_mm256_castps256_ps128(mask)),
+        _mm_castps_si128(_mm256_extractf128_ps(mask, 1)));
+    _mm_maskmoveu_si128(_mm256_cvtps_ph(v, int(R)), m, (char *)dst);
+#else
+    store_half<R>(vfloat4(v.vl), dst, vboolf4(mask.vl));
+    store_half<R>(vfloat4(v.vh), dst + 4, vboolf4(mask.vh));
+#endif
+  }
+
+  // 16-wide //
+
+  template <half_rounding R = half_rounding::nearest>
+  TSIMD_INLINE void store_half(const vfloat16 &v, half_t *dst)
+  {
+#if defined(__AVX512F__)
+    _mm256_storeu_si256((__m256i *)dst, _mm512_cvtps_ph(v, int(R)));
+#else
+    store_half<R>(vfloat8(v.vl), dst);
+    store_half<R>(vfloat8(v.vh), dst + 8);
+#endif
+  }
+
+  template <half_rounding R = half_rounding::nearest>
+  TSIMD_INLINE void store_half(const vfloat16 &v,
+                               half_t *dst,
+                               const vboolf16 &mask)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    _mm256_mask_storeu_epi16(dst, mask, _mm512_cvtps_ph(v, int(R)));
+#elif defined(__AVX512F__)
+    const __m256i h = _mm512_cvtps_ph(v, int(R));
+    const __m256i m =
+        _mm512_cvtepi32_epi16(_mm512_maskz_set1_epi32(mask, -1));
+    _mm_maskmoveu_si128(
+        _mm256_castsi256_si128(h), _mm256_castsi256_si128(m), (char *)dst);
+    _mm_maskmoveu_si128(_mm256_extracti128_si256(h, 1),
+                        _mm256_extracti128_si256(m, 1),
+                        (char *)(dst + 8));
+#else
+    store_half<R>(vfloat8(v.vl), dst, vboolf8(mask.vl));
+    store_half<R>(vfloat8(v.vh), dst + 8, vboolf8(mask.vh));
+#endif
+  }
+
+  // Composite widths //
+
+  template <half_rounding R = half_rounding::nearest,
+            int W,
+            typename = traits::has_halves_t<W>>
+  TSIMD_INLINE void store_half(const vfloatn<W> &v, half_t *dst)
+  {
+    store_half<R>(vfloatn<W / 2>(v.vl), dst);
+    store_half<R>(vfloatn<W / 2>(v.vh), dst + W / 2);
+  }
+
+  template <half_rounding R = half_rounding::nearest,
+            int W,
+            typename = traits::has_halves_t<W>>
+  TSIMD_INLINE void store_half(const vfloatn<W> &v,
+                               half_t *dst,
+                               const vboolfn<W> &mask)
+  {
+    store_half<R>(vfloatn<W / 2>(v.vl), dst, vboolfn<W / 2>(mask.vl));
+    store_half<R>(vfloatn<W / 2>(v.vh), dst + W / 2, vboolfn<W / 2>(mask.vh));
+  }
+
+}  // namespace tsimd
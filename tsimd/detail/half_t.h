@@ -0,0 +1,183 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Jefferson Amstutz                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+
+#pragma once
+
+#include <cfenv>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+#include "config.h"
+
+namespace tsimd {
+
+  // Rounding modes for float --> half conversion /////////////////////////////
+
+  // NOTE: values match the imm8 encoding used by _mm*_cvtps_ph()
+  enum class half_rounding
+  {
+    nearest     = 0x0,
+    down        = 0x1,
+    up          = 0x2,
+    toward_zero = 0x3,
+    current     = 0x4  // whatever the current FP environment says
+  };
+
+  // Scalar IEEE binary16 <--> binary32 conversions ///////////////////////////
+
+  namespace detail {
+
+    TSIMD_INLINE float half_to_float(uint16_t h)
+    {
+      uint32_t sign = uint32_t(h & 0x8000) << 16;
+      uint32_t exp  = (h >> 10) & 0x1f;
+      uint32_t mant = h & 0x3ff;
+      uint32_t bits;
+
+      if (exp == 0x1f) {
+        // NOTE: NaNs come out quiet, same as _mm_cvtph_ps()
+        bits = sign | 0x7f800000 | (mant << 13) | (mant ? 0x400000 : 0);
+      } else if (exp != 0) {
+        bits = sign | ((exp + 112) << 23) | (mant << 13);
+      } else if (mant == 0) {
+        bits = sign;
+      } else {
+        // subnormal half --> normal float
+        int e = -1;
+        do {
+          mant <<= 1;
+          ++e;
+        } while (!(mant & 0x400));
+        bits = sign | (uint32_t(127 - 15 - e) << 23) | ((mant & 0x3ff) << 13);
+      }
+
+      float f;
+      std::memcpy(&f, &bits, sizeof(f));
+      return f;
+    }
+
+    TSIMD_INLINE uint16_t
+    float_to_half(float f, half_rounding r = half_rounding::nearest)
+    {
+      if (r == half_rounding::current) {
+        switch (std::fegetround()) {
+        case FE_DOWNWARD:
+          r = half_rounding::down;
+          break;
+        case FE_UPWARD:
+          r = half_rounding::up;
+          break;
+        case FE_TOWARDZERO:
+          r = half_rounding::toward_zero;
+          break;
+        default:
+          r = half_rounding::nearest;
+        }
+      }
+
+      uint32_t x;
+      std::memcpy(&x, &f, sizeof(x));
+
+      const uint16_t sign = (x >> 16) & 0x8000;
+      const uint32_t abs  = x & 0x7fffffff;
+
+      // NaN/Inf, keeping NaNs quiet
+      if (abs >= 0x7f800000) {
+        return sign | 0x7c00 |
+               (abs > 0x7f800000 ? 0x200 | ((abs >> 13) & 0x3ff) : 0);
+      }
+
+      if (abs == 0)
+        return sign;
+
+      // does rounding move the magnitude away from zero?
+      const bool away = (r == half_rounding::up && !sign) ||
+                        (r == half_rounding::down && sign);
+
+      const int e = int(abs >> 23) - 127;
+
+      if (e > 15) {
+        return sign |
+               (r == half_rounding::nearest || away ? 0x7c00 : 0x7bff);
+      }
+
+      const uint32_t m = (abs & 0x7fffff) | (abs >> 23 ? 0x800000 : 0);
+
+      // normal halves keep 11 mantissa bits, subnormals are in 2^-24 units
+      int shift = e < -14 ? -e - 1 : 13;
+      if (shift > 26)
+        shift = 26;
+
+      const uint32_t q    = m >> shift;
+      const uint32_t rem  = m & ((1u << shift) - 1);
+      const uint32_t half = 1u << (shift - 1);
+
+      uint16_t h = e < -14 ? q : (uint32_t(e + 15) << 10) | (q & 0x3ff);
+
+      // carries out of the mantissa correctly bump the exponent (or to inf)
+      if (r == half_rounding::nearest)
+        h += (rem > half || (rem == half && (h & 1)));
+      else if (away)
+        h += (rem != 0);
+
+      return sign | h;
+    }
+
+  }  // namespace detail
+
+  // 16-bit IEEE half-precision storage type //////////////////////////////////
+
+  // NOTE: this is a storage-only type, load it into a vfloat to do math on it
+  struct half_t
+  {
+    half_t()               = default;
+    half_t(const half_t &) = default;
+    half_t(half_t &&)      = default;
+    half_t &operator=(const half_t &) = default;
+    half_t &operator=(half_t &&) = default;
+
+    TSIMD_INLINE explicit half_t(float f) noexcept
+        : bits(detail::float_to_half(f))
+    {
+    }
+
+    TSIMD_INLINE explicit operator float() const noexcept
+    {
+      return detail::half_to_float(bits);
+    }
+
+    uint16_t bits;
+  };
+
+  static_assert(sizeof(half_t) == 2, "half_t must be 16 bits wide!");
+
+  TSIMD_INLINE std::ostream &operator<<(std::ostream &o, const half_t &v)
+  {
+    o << static_cast<float>(v);
+    return o;
+  }
+
+}  // namespace tsimd
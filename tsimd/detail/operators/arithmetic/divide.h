@@ -28,6 +28,23 @@
 
 namespace tsimd {
 
+#if defined(__AVX__)
+  namespace detail {
+
+    // NOTE: lanes with the top bit set come out of the signed conversion
+    //       2^32 too small
+    TSIMD_INLINE __m256d cvtepu32_pd(__m128i v)
+    {
+      const __m256d d = _mm256_cvtepi32_pd(v);
+      const __m256d negative =
+          _mm256_cmp_pd(d, _mm256_setzero_pd(), _CMP_LT_OQ);
+      return _mm256_add_pd(
+          d, _mm256_and_pd(negative, _mm256_set1_pd(4294967296.0)));
+    }
+
+  }  // namespace detail
+#endif
+
   // 1-wide //
 
   template <typename T>
@@ -36,6 +53,22 @@ namespace tsimd {
     return pack<T, 1>(p1[0] / p2[0]);
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 operator/(const vdouble2 &p1, const vdouble2 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_div_pd(p1, p2);
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] / p2[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 operator/(const vfloat4 &p1, const vfloat4 &p2)
@@ -52,10 +85,73 @@ namespace tsimd {
 #endif
   }
 
+  // NOTE: 32-bit ints convert to double exactly, and the correctly rounded
+  //       double quotient truncates to the exact integer quotient
+
   TSIMD_INLINE vint4 operator/(const vint4 &p1, const vint4 &p2)
   {
+#if defined(__AVX__)
+    const __m256d q =
+        _mm256_div_pd(_mm256_cvtepi32_pd(p1), _mm256_cvtepi32_pd(p2));
+    return _mm256_cvttpd_epi32(q);
+#elif defined(__SSE__)
+    const __m128d ql = _mm_div_pd(_mm_cvtepi32_pd(p1), _mm_cvtepi32_pd(p2));
+    const __m128d qh =
+        _mm_div_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(p1, p1)),
+                   _mm_cvtepi32_pd(_mm_unpackhi_epi64(p2, p2)));
+    return _mm_unpacklo_epi64(_mm_cvttpd_epi32(ql), _mm_cvttpd_epi32(qh));
+#else
     vint4 result;
 
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] / p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 operator/(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__AVX512VL__)
+    const __m256d q =
+        _mm256_div_pd(_mm256_cvtepu32_pd(p1), _mm256_cvtepu32_pd(p2));
+    return _mm256_cvttpd_epu32(q);
+#elif defined(__AVX__)
+    // NOTE: no unsigned conversions before AVX-512, so the quotient is
+    //       shifted by 2^31 to fit the signed conversion, then flipped back
+    const __m256d q = _mm256_floor_pd(
+        _mm256_div_pd(detail::cvtepu32_pd(p1), detail::cvtepu32_pd(p2)));
+    const __m256d two31 = _mm256_set1_pd(2147483648.0);
+    return _mm_xor_si128(_mm256_cvttpd_epi32(_mm256_sub_pd(q, two31)),
+                         _mm_set1_epi32(int(0x80000000)));
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] / p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 operator/(const vdouble4 &p1, const vdouble4 &p2)
+  {
+#if defined(__AVX__)
+    return _mm256_div_pd(p1, p2);
+#else
+    vdouble4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] / p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong4 operator/(const vllong4 &p1, const vllong4 &p2)
+  {
+    vllong4 result;
+
 #if TSIMD_USE_OPENMP
 #  pragma omp simd
 #endif
@@ -79,7 +175,40 @@ namespace tsimd {
 
   TSIMD_INLINE vint8 operator/(const vint8 &p1, const vint8 &p2)
   {
+#if defined(__AVX512F__)
+    const __m512d q =
+        _mm512_div_pd(_mm512_cvtepi32_pd(p1), _mm512_cvtepi32_pd(p2));
+    return _mm512_cvttpd_epi32(q);
+#else
     return vint8(vint4(p1.vl) / vint4(p2.vl), vint4(p1.vh) / vint4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vuint8 operator/(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX512F__)
+    const __m512d q =
+        _mm512_div_pd(_mm512_cvtepu32_pd(p1), _mm512_cvtepu32_pd(p2));
+    return _mm512_cvttpd_epu32(q);
+#else
+    return vuint8(vuint4(p1.vl) / vuint4(p2.vl), vuint4(p1.vh) / vuint4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vdouble8 operator/(const vdouble8 &p1, const vdouble8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_div_pd(p1, p2);
+#else
+    return vdouble8(vdouble4(p1.vl) / vdouble4(p2.vl),
+                    vdouble4(p1.vh) / vdouble4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 operator/(const vllong8 &p1, const vllong8 &p2)
+  {
+    return vllong8(vllong4(p1.vl) / vllong4(p2.vl),
+                   vllong4(p1.vh) / vllong4(p2.vh));
   }
 
   // 16-wide //
@@ -99,6 +228,22 @@ namespace tsimd {
     return vint16(vint8(p1.vl) / vint8(p2.vl), vint8(p1.vh) / vint8(p2.vh));
   }
 
+  TSIMD_INLINE vuint16 operator/(const vuint16 &p1, const vuint16 &p2)
+  {
+    return vuint16(vuint8(p1.vl) / vuint8(p2.vl),
+                   vuint8(p1.vh) / vuint8(p2.vh));
+  }
+
+  // Composite widths //
+
+  template <typename T, int W, typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> operator/(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(half_pack(p1.vl) / half_pack(p2.vl),
+                      half_pack(p1.vh) / half_pack(p2.vh));
+  }
+
   // Inferred pack-scalar operators ///////////////////////////////////////////
 
   template <typename T,
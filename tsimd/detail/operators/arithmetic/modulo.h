@@ -25,6 +25,9 @@
 #pragma once
 
 #include "../../pack.h"
+#include "divide.h"
+#include "minus.h"
+#include "times.h"
 
 namespace tsimd {
 
@@ -42,6 +45,44 @@ namespace tsimd {
     return result;
   }
 
+  // NOTE: 32-bit ints get the remainder from the vectorized division
+
+  // 4-wide //
+
+  TSIMD_INLINE vint4 operator%(const vint4 &p1, const vint4 &p2)
+  {
+    return p1 - (p1 / p2) * p2;
+  }
+
+  TSIMD_INLINE vuint4 operator%(const vuint4 &p1, const vuint4 &p2)
+  {
+    return p1 - (p1 / p2) * p2;
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vint8 operator%(const vint8 &p1, const vint8 &p2)
+  {
+    return p1 - (p1 / p2) * p2;
+  }
+
+  TSIMD_INLINE vuint8 operator%(const vuint8 &p1, const vuint8 &p2)
+  {
+    return p1 - (p1 / p2) * p2;
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vint16 operator%(const vint16 &p1, const vint16 &p2)
+  {
+    return p1 - (p1 / p2) * p2;
+  }
+
+  TSIMD_INLINE vuint16 operator%(const vuint16 &p1, const vuint16 &p2)
+  {
+    return p1 - (p1 / p2) * p2;
+  }
+
   // Inferred pack<>/scalar operators /////////////////////////////////////////
 
   template <typename T,
@@ -36,6 +36,36 @@ namespace tsimd {
     return pack<T, 1>(p1[0] + p2[0]);
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 operator+(const vdouble2 &p1, const vdouble2 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_add_pd(p1, p2);
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] + p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong2 operator+(const vllong2 &p1, const vllong2 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_add_epi64(p1, p2);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] + p2[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 operator+(const vfloat4 &p1, const vfloat4 &p2)
@@ -66,6 +96,50 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint4 operator+(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_add_epi32(p1, p2);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] + p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 operator+(const vdouble4 &p1, const vdouble4 &p2)
+  {
+#if defined(__AVX__)
+    return _mm256_add_pd(p1, p2);
+#else
+    vdouble4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] + p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong4 operator+(const vllong4 &p1, const vllong4 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_add_epi64(p1, p2);
+#elif defined(__AVX__)
+    return vllong4(_mm_add_epi64(p1.vl, p2.vl), _mm_add_epi64(p1.vh, p2.vh));
+#else
+    vllong4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] + p2[i]);
+
+    return result;
+#endif
+  }
+
   // 8-wide //
 
   TSIMD_INLINE vfloat8 operator+(const vfloat8 &p1, const vfloat8 &p2)
@@ -89,6 +163,65 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint8 operator+(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX512__) || defined(__AVX2__)
+    return _mm256_add_epi32(p1, p2);
+#elif defined(__AVX__)
+    return vuint8(_mm_add_epi32(p1.vl, p2.vl), _mm_add_epi32(p1.vh, p2.vh));
+#else
+    return vuint8(vuint4(p1.vl) + vuint4(p2.vl), vuint4(p1.vh) + vuint4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vdouble8 operator+(const vdouble8 &p1, const vdouble8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_add_pd(p1, p2);
+#else
+    return vdouble8(vdouble4(p1.vl) + vdouble4(p2.vl),
+                    vdouble4(p1.vh) + vdouble4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 operator+(const vllong8 &p1, const vllong8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_add_epi64(p1, p2);
+#else
+    return vllong8(vllong4(p1.vl) + vllong4(p2.vl),
+                   vllong4(p1.vh) + vllong4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vshort8 operator+(const vshort8 &p1, const vshort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_add_epi16(p1, p2);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = (p1[i] + p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 operator+(const vushort8 &p1, const vushort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_add_epi16(p1, p2);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = (p1[i] + p2[i]);
+
+    return result;
+#endif
+  }
+
   // 16-wide //
 
   TSIMD_INLINE vfloat16 operator+(const vfloat16 &p1, const vfloat16 &p2)
@@ -110,6 +243,138 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint16 operator+(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_add_epi32(p1, p2);
+#else
+    return vuint16(vuint8(p1.vl) + vuint8(p2.vl),
+                   vuint8(p1.vh) + vuint8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vschar16 operator+(const vschar16 &p1, const vschar16 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_add_epi8(p1, p2);
+#else
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = (p1[i] + p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuchar16 operator+(const vuchar16 &p1, const vuchar16 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_add_epi8(p1, p2);
+#else
+    vuchar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = (p1[i] + p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort16 operator+(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_add_epi16(p1, p2);
+#else
+    return vshort16(vshort8(p1.vl) + vshort8(p2.vl),
+                    vshort8(p1.vh) + vshort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 operator+(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_add_epi16(p1, p2);
+#else
+    return vushort16(vushort8(p1.vl) + vushort8(p2.vl),
+                     vushort8(p1.vh) + vushort8(p2.vh));
+#endif
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE vschar32 operator+(const vschar32 &p1, const vschar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_add_epi8(p1, p2);
+#else
+    return vschar32(vschar16(p1.vl) + vschar16(p2.vl),
+                    vschar16(p1.vh) + vschar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 operator+(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_add_epi8(p1, p2);
+#else
+    return vuchar32(vuchar16(p1.vl) + vuchar16(p2.vl),
+                    vuchar16(p1.vh) + vuchar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 operator+(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_add_epi16(p1, p2);
+#else
+    return vshort32(vshort16(p1.vl) + vshort16(p2.vl),
+                    vshort16(p1.vh) + vshort16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 operator+(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_add_epi16(p1, p2);
+#else
+    return vushort32(vushort16(p1.vl) + vushort16(p2.vl),
+                     vushort16(p1.vh) + vushort16(p2.vh));
+#endif
+  }
+
+  // 64-wide //
+
+  TSIMD_INLINE vschar64 operator+(const vschar64 &p1, const vschar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_add_epi8(p1, p2);
+#else
+    return vschar64(vschar32(p1.vl) + vschar32(p2.vl),
+                    vschar32(p1.vh) + vschar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 operator+(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_add_epi8(p1, p2);
+#else
+    return vuchar64(vuchar32(p1.vl) + vuchar32(p2.vl),
+                    vuchar32(p1.vh) + vuchar32(p2.vh));
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename T, int W, typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> operator+(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(half_pack(p1.vl) + half_pack(p2.vl),
+                      half_pack(p1.vh) + half_pack(p2.vh));
+  }
+
   // Inferred pack-scalar operators ///////////////////////////////////////////
 
   template <typename T,
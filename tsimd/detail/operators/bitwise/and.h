@@ -38,6 +38,38 @@ namespace tsimd {
     return pack<T, 1>(p1[0] & p2[0]);
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vllong2 operator&(const vllong2 &p1, const vllong2 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(p1, p2);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboold2 operator&(const vboold2 &p1, const vboold2 &p2)
+  {
+#if defined(__AVX512VL__)
+    return __mmask8(p1.v & p2.v);
+#elif defined(__SSE__)
+    return _mm_and_pd(p1, p2);
+#else
+    vboold2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vint4 operator&(const vint4 &p1, const vint4 &p2)
@@ -54,9 +86,25 @@ namespace tsimd {
 #endif
   }
 
-  TSIMD_INLINE vboolf4 operator&(const vboolf4 &p1, const vboolf4 &p2)
+  TSIMD_INLINE vuint4 operator&(const vuint4 &p1, const vuint4 &p2)
   {
 #if defined(__SSE__)
+    return _mm_and_si128(p1, p2);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboolf4 operator&(const vboolf4 &p1, const vboolf4 &p2)
+  {
+#if defined(__AVX512VL__)
+    return __mmask8(p1.v & p2.v);
+#elif defined(__SSE__)
     return _mm_and_ps(p1, p2);
 #else
     vboolf4 result;
@@ -68,6 +116,39 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vllong4 operator&(const vllong4 &p1, const vllong4 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(p1, p2);
+#elif defined(__AVX__)
+    return _mm256_castpd_si256(
+        _mm256_and_pd(_mm256_castsi256_pd(p1), _mm256_castsi256_pd(p2)));
+#else
+    vllong4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboold4 operator&(const vboold4 &p1, const vboold4 &p2)
+  {
+#if defined(__AVX512VL__)
+    return __mmask8(p1.v & p2.v);
+#elif defined(__AVX__)
+    return _mm256_and_pd(p1, p2);
+#else
+    vboold4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
   // 8-wide //
 
   TSIMD_INLINE vint8 operator&(const vint8 &p1, const vint8 &p2)
@@ -82,9 +163,23 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint8 operator&(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX512F__) || defined(__AVX2__)
+    return _mm256_and_si256(p1, p2);
+#elif defined(__AVX__)
+    return _mm256_castps_si256(
+        _mm256_and_ps(_mm256_castsi256_ps(p1), _mm256_castsi256_ps(p2)));
+#else
+    return vuint8(vuint4(p1.vl) & vuint4(p2.vl), vuint4(p1.vh) & vuint4(p2.vh));
+#endif
+  }
+
   TSIMD_INLINE vboolf8 operator&(const vboolf8 &p1, const vboolf8 &p2)
   {
-#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return __mmask8(p1.v & p2.v);
+#elif defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
     return _mm256_and_ps(p1, p2);
 #else
     return vboolf8(vboolf4(p1.vl) & vboolf4(p2.vl),
@@ -92,6 +187,68 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vllong8 operator&(const vllong8 &p1, const vllong8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_and_epi64(p1, p2);
+#else
+    return vllong8(vllong4(p1.vl) & vllong4(p2.vl),
+                   vllong4(p1.vh) & vllong4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboold8 operator&(const vboold8 &p1, const vboold8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_kand(p1, p2);
+#else
+    return vboold8(vboold4(p1.vl) & vboold4(p2.vl),
+                   vboold4(p1.vh) & vboold4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vshort8 operator&(const vshort8 &p1, const vshort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(p1, p2);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 operator&(const vushort8 &p1, const vushort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(p1, p2);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboolw8 operator&(const vboolw8 &p1, const vboolw8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(p1, p2);
+#else
+    vboolw8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
   // 16-wide //
 
   TSIMD_INLINE vint16 operator&(const vint16 &p1, const vint16 &p2)
@@ -103,6 +260,16 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint16 operator&(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_and_epi32(p1, p2);
+#else
+    return vuint16(vuint8(p1.vl) & vuint8(p2.vl),
+                   vuint8(p1.vh) & vuint8(p2.vh));
+#endif
+  }
+
   TSIMD_INLINE vboolf16 operator&(const vboolf16 &p1, const vboolf16 &p2)
   {
 #if defined(__AVX512F__)
@@ -113,6 +280,182 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vschar16 operator&(const vschar16 &p1, const vschar16 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(p1, p2);
+#else
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuchar16 operator&(const vuchar16 &p1, const vuchar16 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(p1, p2);
+#else
+    vuchar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort16 operator&(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(p1, p2);
+#else
+    return vshort16(vshort8(p1.vl) & vshort8(p2.vl),
+                    vshort8(p1.vh) & vshort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 operator&(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(p1, p2);
+#else
+    return vushort16(vushort8(p1.vl) & vushort8(p2.vl),
+                     vushort8(p1.vh) & vushort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolb16 operator&(const vboolb16 &p1, const vboolb16 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(p1, p2);
+#else
+    vboolb16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = p1[i] & p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboolw16 operator&(const vboolw16 &p1, const vboolw16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(p1, p2);
+#else
+    return vboolw16(vboolw8(p1.vl) & vboolw8(p2.vl),
+                    vboolw8(p1.vh) & vboolw8(p2.vh));
+#endif
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE vschar32 operator&(const vschar32 &p1, const vschar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(p1, p2);
+#else
+    return vschar32(vschar16(p1.vl) & vschar16(p2.vl),
+                    vschar16(p1.vh) & vschar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 operator&(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(p1, p2);
+#else
+    return vuchar32(vuchar16(p1.vl) & vuchar16(p2.vl),
+                    vuchar16(p1.vh) & vuchar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 operator&(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_and_si512(p1, p2);
+#else
+    return vshort32(vshort16(p1.vl) & vshort16(p2.vl),
+                    vshort16(p1.vh) & vshort16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 operator&(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_and_si512(p1, p2);
+#else
+    return vushort32(vushort16(p1.vl) & vushort16(p2.vl),
+                     vushort16(p1.vh) & vushort16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolb32 operator&(const vboolb32 &p1, const vboolb32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(p1, p2);
+#else
+    return vboolb32(vboolb16(p1.vl) & vboolb16(p2.vl),
+                    vboolb16(p1.vh) & vboolb16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolw32 operator&(const vboolw32 &p1, const vboolw32 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_and_si512(p1, p2);
+#else
+    return vboolw32(vboolw16(p1.vl) & vboolw16(p2.vl),
+                    vboolw16(p1.vh) & vboolw16(p2.vh));
+#endif
+  }
+
+  // 64-wide //
+
+  TSIMD_INLINE vschar64 operator&(const vschar64 &p1, const vschar64 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_and_si512(p1, p2);
+#else
+    return vschar64(vschar32(p1.vl) & vschar32(p2.vl),
+                    vschar32(p1.vh) & vschar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 operator&(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_and_si512(p1, p2);
+#else
+    return vuchar64(vuchar32(p1.vl) & vuchar32(p2.vl),
+                    vuchar32(p1.vh) & vuchar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolb64 operator&(const vboolb64 &p1, const vboolb64 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_and_si512(p1, p2);
+#else
+    return vboolb64(vboolb32(p1.vl) & vboolb32(p2.vl),
+                    vboolb32(p1.vh) & vboolb32(p2.vh));
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename T, int W, typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> operator&(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(half_pack(p1.vl) & half_pack(p2.vl),
+                      half_pack(p1.vh) & half_pack(p2.vh));
+  }
+
   // Inferred pack-scalar operators ///////////////////////////////////////////
 
   template <typename T,
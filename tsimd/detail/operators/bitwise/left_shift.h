@@ -24,25 +24,544 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "../../pack.h"
 
 namespace tsimd {
 
-  template <typename T, int W>
-  TSIMD_INLINE pack<T, W> operator<<(const pack<T, W> &p1, const pack<T, W> &p2)
+  // NOTE: uniform counts lower to slli and per-lane counts to sllv where
+  //       the ISA has them; counts must be in [0, bits of T)
+
+  namespace detail {
+
+    template <typename T>
+    TSIMD_INLINE T sll1(T v, int n)
+    {
+      using unsigned_t = typename std::make_unsigned<T>::type;
+      return T(unsigned_t(v) << n);
+    }
+
+  }  // namespace detail
+
+  // 1-wide //
+
+  template <typename T, typename = traits::is_integral_t<T>>
+  TSIMD_INLINE pack<T, 1> sll(const pack<T, 1> &p, int n)
+  {
+    return pack<T, 1>(detail::sll1(p[0], n));
+  }
+
+  template <typename T, typename = traits::is_integral_t<T>>
+  TSIMD_INLINE pack<T, 1> sll(const pack<T, 1> &p, const pack<T, 1> &n)
+  {
+    return pack<T, 1>(detail::sll1(p[0], int(n[0])));
+  }
+
+  // NOTE: there are no 8-bit shifts, so 8-bit lanes are shifted as 16-bit
+  //       lanes and the bits shifted in from the neighbouring byte are masked
+  //       off
+
+  // 2-wide //
+
+  TSIMD_INLINE vllong2 sll(const vllong2 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_slli_epi64(p, n);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = detail::sll1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong2 sll(const vllong2 &p, const vllong2 &n)
+  {
+#if defined(__AVX2__)
+    return _mm_sllv_epi64(p, n);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = detail::sll1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vint4 sll(const vint4 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_slli_epi32(p, n);
+#else
+    vint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = detail::sll1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vint4 sll(const vint4 &p, const vint4 &n)
+  {
+#if defined(__AVX2__)
+    return _mm_sllv_epi32(p, n);
+#else
+    vint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = detail::sll1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 sll(const vuint4 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_slli_epi32(p, n);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = detail::sll1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 sll(const vuint4 &p, const vuint4 &n)
+  {
+#if defined(__AVX2__)
+    return _mm_sllv_epi32(p, n);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = detail::sll1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong4 sll(const vllong4 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_slli_epi64(p, n);
+#else
+    return vllong4(sll(vllong2(p.vl), n),
+                   sll(vllong2(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vllong4 sll(const vllong4 &p, const vllong4 &n)
+  {
+#if defined(__AVX2__)
+    return _mm256_sllv_epi64(p, n);
+#else
+    return vllong4(sll(vllong2(p.vl), vllong2(n.vl)),
+                   sll(vllong2(p.vh), vllong2(n.vh)));
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vshort8 sll(const vshort8 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_slli_epi16(p, n);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = detail::sll1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort8 sll(const vshort8 &p, const vshort8 &n)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_sllv_epi16(p, n);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = detail::sll1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 sll(const vushort8 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_slli_epi16(p, n);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = detail::sll1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 sll(const vushort8 &p, const vushort8 &n)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_sllv_epi16(p, n);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = detail::sll1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vint8 sll(const vint8 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_slli_epi32(p, n);
+#else
+    return vint8(sll(vint4(p.vl), n),
+                 sll(vint4(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vint8 sll(const vint8 &p, const vint8 &n)
+  {
+#if defined(__AVX2__)
+    return _mm256_sllv_epi32(p, n);
+#else
+    return vint8(sll(vint4(p.vl), vint4(n.vl)),
+                 sll(vint4(p.vh), vint4(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuint8 sll(const vuint8 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_slli_epi32(p, n);
+#else
+    return vuint8(sll(vuint4(p.vl), n),
+                  sll(vuint4(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuint8 sll(const vuint8 &p, const vuint8 &n)
+  {
+#if defined(__AVX2__)
+    return _mm256_sllv_epi32(p, n);
+#else
+    return vuint8(sll(vuint4(p.vl), vuint4(n.vl)),
+                  sll(vuint4(p.vh), vuint4(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 sll(const vllong8 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_slli_epi64(p, n);
+#else
+    return vllong8(sll(vllong4(p.vl), n),
+                   sll(vllong4(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 sll(const vllong8 &p, const vllong8 &n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_sllv_epi64(p, n);
+#else
+    return vllong8(sll(vllong4(p.vl), vllong4(n.vl)),
+                   sll(vllong4(p.vh), vllong4(n.vh)));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vschar16 sll(const vschar16 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(_mm_slli_epi16(p, n),
+                         _mm_set1_epi8(char(0xff << n)));
+#else
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = detail::sll1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vschar16 sll(const vschar16 &p, const vschar16 &n)
+  {
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = detail::sll1(p[i], int(n[i]));
+
+    return result;
+  }
+
+  TSIMD_INLINE vuchar16 sll(const vuchar16 &p, int n)
   {
-    pack<T, W> result;
+#if defined(__SSE__)
+    return _mm_and_si128(_mm_slli_epi16(p, n),
+                         _mm_set1_epi8(char(0xff << n)));
+#else
+    vuchar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = detail::sll1(p[i], n);
 
-#if TSIMD_USE_OPENMP
-#  pragma omp simd
+    return result;
 #endif
-    for (int i = 0; i < W; ++i)
-      result[i] = (p1[i] << p2[i]);
+  }
+
+  TSIMD_INLINE vuchar16 sll(const vuchar16 &p, const vuchar16 &n)
+  {
+    vuchar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = detail::sll1(p[i], int(n[i]));
 
     return result;
   }
 
-  // Inferred pack<>/scalar operators /////////////////////////////////////////
+  TSIMD_INLINE vshort16 sll(const vshort16 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_slli_epi16(p, n);
+#else
+    return vshort16(sll(vshort8(p.vl), n),
+                    sll(vshort8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 sll(const vshort16 &p, const vshort16 &n)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_sllv_epi16(p, n);
+#else
+    return vshort16(sll(vshort8(p.vl), vshort8(n.vl)),
+                    sll(vshort8(p.vh), vshort8(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 sll(const vushort16 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_slli_epi16(p, n);
+#else
+    return vushort16(sll(vushort8(p.vl), n),
+                     sll(vushort8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 sll(const vushort16 &p, const vushort16 &n)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_sllv_epi16(p, n);
+#else
+    return vushort16(sll(vushort8(p.vl), vushort8(n.vl)),
+                     sll(vushort8(p.vh), vushort8(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vint16 sll(const vint16 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_slli_epi32(p, n);
+#else
+    return vint16(sll(vint8(p.vl), n),
+                  sll(vint8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vint16 sll(const vint16 &p, const vint16 &n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_sllv_epi32(p, n);
+#else
+    return vint16(sll(vint8(p.vl), vint8(n.vl)),
+                  sll(vint8(p.vh), vint8(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuint16 sll(const vuint16 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_slli_epi32(p, n);
+#else
+    return vuint16(sll(vuint8(p.vl), n),
+                   sll(vuint8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuint16 sll(const vuint16 &p, const vuint16 &n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_sllv_epi32(p, n);
+#else
+    return vuint16(sll(vuint8(p.vl), vuint8(n.vl)),
+                   sll(vuint8(p.vh), vuint8(n.vh)));
+#endif
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE vschar32 sll(const vschar32 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(_mm256_slli_epi16(p, n),
+                            _mm256_set1_epi8(char(0xff << n)));
+#else
+    return vschar32(sll(vschar16(p.vl), n),
+                    sll(vschar16(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vschar32 sll(const vschar32 &p, const vschar32 &n)
+  {
+    return vschar32(sll(vschar16(p.vl), vschar16(n.vl)),
+                    sll(vschar16(p.vh), vschar16(n.vh)));
+  }
+
+  TSIMD_INLINE vuchar32 sll(const vuchar32 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(_mm256_slli_epi16(p, n),
+                            _mm256_set1_epi8(char(0xff << n)));
+#else
+    return vuchar32(sll(vuchar16(p.vl), n),
+                    sll(vuchar16(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 sll(const vuchar32 &p, const vuchar32 &n)
+  {
+    return vuchar32(sll(vuchar16(p.vl), vuchar16(n.vl)),
+                    sll(vuchar16(p.vh), vuchar16(n.vh)));
+  }
+
+  TSIMD_INLINE vshort32 sll(const vshort32 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_slli_epi16(p, n);
+#else
+    return vshort32(sll(vshort16(p.vl), n),
+                    sll(vshort16(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 sll(const vshort32 &p, const vshort32 &n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_sllv_epi16(p, n);
+#else
+    return vshort32(sll(vshort16(p.vl), vshort16(n.vl)),
+                    sll(vshort16(p.vh), vshort16(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 sll(const vushort32 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_slli_epi16(p, n);
+#else
+    return vushort32(sll(vushort16(p.vl), n),
+                     sll(vushort16(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 sll(const vushort32 &p, const vushort32 &n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_sllv_epi16(p, n);
+#else
+    return vushort32(sll(vushort16(p.vl), vushort16(n.vl)),
+                     sll(vushort16(p.vh), vushort16(n.vh)));
+#endif
+  }
+
+  // 64-wide //
+
+  TSIMD_INLINE vschar64 sll(const vschar64 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_and_si512(_mm512_slli_epi16(p, n),
+                            _mm512_set1_epi8(char(0xff << n)));
+#else
+    return vschar64(sll(vschar32(p.vl), n),
+                    sll(vschar32(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vschar64 sll(const vschar64 &p, const vschar64 &n)
+  {
+    return vschar64(sll(vschar32(p.vl), vschar32(n.vl)),
+                    sll(vschar32(p.vh), vschar32(n.vh)));
+  }
+
+  TSIMD_INLINE vuchar64 sll(const vuchar64 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_and_si512(_mm512_slli_epi16(p, n),
+                            _mm512_set1_epi8(char(0xff << n)));
+#else
+    return vuchar64(sll(vuchar32(p.vl), n),
+                    sll(vuchar32(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 sll(const vuchar64 &p, const vuchar64 &n)
+  {
+    return vuchar64(sll(vuchar32(p.vl), vuchar32(n.vl)),
+                    sll(vuchar32(p.vh), vuchar32(n.vh)));
+  }
+
+  // Composite widths //
+
+  template <typename T,
+            int W,
+            typename = traits::is_integral_t<T>,
+            typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> sll(const pack<T, W> &p, int n)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(sll(half_pack(p.vl), n), sll(half_pack(p.vh), n));
+  }
+
+  template <typename T,
+            int W,
+            typename = traits::is_integral_t<T>,
+            typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> sll(const pack<T, W> &p, const pack<T, W> &n)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(sll(half_pack(p.vl), half_pack(n.vl)),
+                      sll(half_pack(p.vh), half_pack(n.vh)));
+  }
+
+  // Inferred operators ///////////////////////////////////////////////////////
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> operator<<(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return sll(p1, p2);
+  }
 
   template <typename T,
             int W,
@@ -50,7 +569,7 @@ namespace tsimd {
             typename = traits::can_convert<OTHER_T, T>>
   TSIMD_INLINE pack<T, W> operator<<(const pack<T, W> &p1, const OTHER_T &v)
   {
-    return p1 << pack<T, W>(v);
+    return sll(p1, int(v));
   }
 
   template <typename T,
@@ -59,7 +578,24 @@ namespace tsimd {
             typename = traits::can_convert<OTHER_T, T>>
   TSIMD_INLINE pack<T, W> operator<<(const OTHER_T &v, const pack<T, W> &p1)
   {
-    return pack<T, W>(v) << p1;
+    return sll(pack<T, W>(v), p1);
+  }
+
+  // Inferred binary operator<<=() ////////////////////////////////////////////
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> &operator<<=(pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return p1 = (p1 << p2);
+  }
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename = traits::can_convert<OTHER_T, T>>
+  TSIMD_INLINE pack<T, W> &operator<<=(pack<T, W> &p1, const OTHER_T &v)
+  {
+    return p1 = (p1 << v);
   }
 
 }  // namespace tsimd
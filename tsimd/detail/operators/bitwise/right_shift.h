@@ -24,25 +24,1078 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "../../pack.h"
 
 namespace tsimd {
 
-  template <typename T, int W>
-  TSIMD_INLINE pack<T, W> operator>>(const pack<T, W> &p1, const pack<T, W> &p2)
+  // NOTE: srl() is a logical (zero filling) right shift and sra() is an
+  //       arithmetic (sign filling) right shift, regardless of the signedness
+  //       of T; operator>>() picks sra() for signed and srl() for unsigned T.
+  //       Uniform counts lower to srli/srai and per-lane counts to
+  //       srlv/srav where the ISA has them; counts must be in [0, bits of T)
+
+  namespace detail {
+
+    template <typename T>
+    TSIMD_INLINE T srl1(T v, int n)
+    {
+      using unsigned_t = typename std::make_unsigned<T>::type;
+      return T(unsigned_t(v) >> n);
+    }
+
+    template <typename T>
+    TSIMD_INLINE T sra1(T v, int n)
+    {
+      using signed_t = typename std::make_signed<T>::type;
+      return T(signed_t(v) >> n);
+    }
+
+  }  // namespace detail
+
+  // 1-wide //
+
+  template <typename T, typename = traits::is_integral_t<T>>
+  TSIMD_INLINE pack<T, 1> srl(const pack<T, 1> &p, int n)
+  {
+    return pack<T, 1>(detail::srl1(p[0], n));
+  }
+
+  template <typename T, typename = traits::is_integral_t<T>>
+  TSIMD_INLINE pack<T, 1> srl(const pack<T, 1> &p, const pack<T, 1> &n)
+  {
+    return pack<T, 1>(detail::srl1(p[0], int(n[0])));
+  }
+
+  template <typename T, typename = traits::is_integral_t<T>>
+  TSIMD_INLINE pack<T, 1> sra(const pack<T, 1> &p, int n)
+  {
+    return pack<T, 1>(detail::sra1(p[0], n));
+  }
+
+  template <typename T, typename = traits::is_integral_t<T>>
+  TSIMD_INLINE pack<T, 1> sra(const pack<T, 1> &p, const pack<T, 1> &n)
+  {
+    return pack<T, 1>(detail::sra1(p[0], int(n[0])));
+  }
+
+  // NOTE: there are no 8-bit shifts, so 8-bit lanes are shifted as 16-bit
+  //       lanes and the bits shifted in from the neighbouring byte are masked
+  //       off; sra() then sign extends by flipping and subtracting the
+  //       shifted sign bit (counts saturate at 7, same as srai)
+
+  // 2-wide //
+
+  TSIMD_INLINE vllong2 srl(const vllong2 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_srli_epi64(p, n);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = detail::srl1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong2 srl(const vllong2 &p, const vllong2 &n)
+  {
+#if defined(__AVX2__)
+    return _mm_srlv_epi64(p, n);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = detail::srl1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong2 sra(const vllong2 &p, int n)
+  {
+#if defined(__AVX512VL__)
+    return _mm_srai_epi64(p, n);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = detail::sra1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong2 sra(const vllong2 &p, const vllong2 &n)
+  {
+#if defined(__AVX512VL__)
+    return _mm_srav_epi64(p, n);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = detail::sra1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vint4 srl(const vint4 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_srli_epi32(p, n);
+#else
+    vint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = detail::srl1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vint4 srl(const vint4 &p, const vint4 &n)
+  {
+#if defined(__AVX2__)
+    return _mm_srlv_epi32(p, n);
+#else
+    vint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = detail::srl1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vint4 sra(const vint4 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_srai_epi32(p, n);
+#else
+    vint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = detail::sra1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vint4 sra(const vint4 &p, const vint4 &n)
+  {
+#if defined(__AVX2__)
+    return _mm_srav_epi32(p, n);
+#else
+    vint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = detail::sra1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 srl(const vuint4 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_srli_epi32(p, n);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = detail::srl1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 srl(const vuint4 &p, const vuint4 &n)
+  {
+#if defined(__AVX2__)
+    return _mm_srlv_epi32(p, n);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = detail::srl1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 sra(const vuint4 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_srai_epi32(p, n);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = detail::sra1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 sra(const vuint4 &p, const vuint4 &n)
+  {
+#if defined(__AVX2__)
+    return _mm_srav_epi32(p, n);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = detail::sra1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong4 srl(const vllong4 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srli_epi64(p, n);
+#else
+    return vllong4(srl(vllong2(p.vl), n),
+                   srl(vllong2(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vllong4 srl(const vllong4 &p, const vllong4 &n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srlv_epi64(p, n);
+#else
+    return vllong4(srl(vllong2(p.vl), vllong2(n.vl)),
+                   srl(vllong2(p.vh), vllong2(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vllong4 sra(const vllong4 &p, int n)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_srai_epi64(p, n);
+#else
+    return vllong4(sra(vllong2(p.vl), n),
+                   sra(vllong2(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vllong4 sra(const vllong4 &p, const vllong4 &n)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_srav_epi64(p, n);
+#else
+    return vllong4(sra(vllong2(p.vl), vllong2(n.vl)),
+                   sra(vllong2(p.vh), vllong2(n.vh)));
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vshort8 srl(const vshort8 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_srli_epi16(p, n);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = detail::srl1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort8 srl(const vshort8 &p, const vshort8 &n)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_srlv_epi16(p, n);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = detail::srl1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort8 sra(const vshort8 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_srai_epi16(p, n);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = detail::sra1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vshort8 sra(const vshort8 &p, const vshort8 &n)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_srav_epi16(p, n);
+#else
+    vshort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = detail::sra1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 srl(const vushort8 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_srli_epi16(p, n);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = detail::srl1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 srl(const vushort8 &p, const vushort8 &n)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_srlv_epi16(p, n);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = detail::srl1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 sra(const vushort8 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_srai_epi16(p, n);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = detail::sra1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vushort8 sra(const vushort8 &p, const vushort8 &n)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm_srav_epi16(p, n);
+#else
+    vushort8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = detail::sra1(p[i], int(n[i]));
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vint8 srl(const vint8 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srli_epi32(p, n);
+#else
+    return vint8(srl(vint4(p.vl), n),
+                 srl(vint4(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vint8 srl(const vint8 &p, const vint8 &n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srlv_epi32(p, n);
+#else
+    return vint8(srl(vint4(p.vl), vint4(n.vl)),
+                 srl(vint4(p.vh), vint4(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vint8 sra(const vint8 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srai_epi32(p, n);
+#else
+    return vint8(sra(vint4(p.vl), n),
+                 sra(vint4(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vint8 sra(const vint8 &p, const vint8 &n)
   {
-    pack<T, W> result;
+#if defined(__AVX2__)
+    return _mm256_srav_epi32(p, n);
+#else
+    return vint8(sra(vint4(p.vl), vint4(n.vl)),
+                 sra(vint4(p.vh), vint4(n.vh)));
+#endif
+  }
 
-#if TSIMD_USE_OPENMP
-#  pragma omp simd
+  TSIMD_INLINE vuint8 srl(const vuint8 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srli_epi32(p, n);
+#else
+    return vuint8(srl(vuint4(p.vl), n),
+                  srl(vuint4(p.vh), n));
 #endif
-    for (int i = 0; i < W; ++i)
-      result[i] = (p1[i] >> p2[i]);
+  }
+
+  TSIMD_INLINE vuint8 srl(const vuint8 &p, const vuint8 &n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srlv_epi32(p, n);
+#else
+    return vuint8(srl(vuint4(p.vl), vuint4(n.vl)),
+                  srl(vuint4(p.vh), vuint4(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuint8 sra(const vuint8 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srai_epi32(p, n);
+#else
+    return vuint8(sra(vuint4(p.vl), n),
+                  sra(vuint4(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuint8 sra(const vuint8 &p, const vuint8 &n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srav_epi32(p, n);
+#else
+    return vuint8(sra(vuint4(p.vl), vuint4(n.vl)),
+                  sra(vuint4(p.vh), vuint4(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 srl(const vllong8 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srli_epi64(p, n);
+#else
+    return vllong8(srl(vllong4(p.vl), n),
+                   srl(vllong4(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 srl(const vllong8 &p, const vllong8 &n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srlv_epi64(p, n);
+#else
+    return vllong8(srl(vllong4(p.vl), vllong4(n.vl)),
+                   srl(vllong4(p.vh), vllong4(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 sra(const vllong8 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srai_epi64(p, n);
+#else
+    return vllong8(sra(vllong4(p.vl), n),
+                   sra(vllong4(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 sra(const vllong8 &p, const vllong8 &n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srav_epi64(p, n);
+#else
+    return vllong8(sra(vllong4(p.vl), vllong4(n.vl)),
+                   sra(vllong4(p.vh), vllong4(n.vh)));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vschar16 srl(const vschar16 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(_mm_srli_epi16(p, n),
+                         _mm_set1_epi8(char(0xff >> n)));
+#else
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = detail::srl1(p[i], n);
 
     return result;
+#endif
   }
 
-  // Inferred pack<>/scalar operators /////////////////////////////////////////
+  TSIMD_INLINE vschar16 srl(const vschar16 &p, const vschar16 &n)
+  {
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = detail::srl1(p[i], int(n[i]));
+
+    return result;
+  }
+
+  TSIMD_INLINE vschar16 sra(const vschar16 &p, int n)
+  {
+#if defined(__SSE__)
+    n = n > 7 ? 7 : n;
+    const __m128i t = srl(p, n);
+    const __m128i m = _mm_set1_epi8(char(0x80 >> n));
+    return _mm_sub_epi8(_mm_xor_si128(t, m), m);
+#else
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = detail::sra1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vschar16 sra(const vschar16 &p, const vschar16 &n)
+  {
+    vschar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = detail::sra1(p[i], int(n[i]));
+
+    return result;
+  }
+
+  TSIMD_INLINE vuchar16 srl(const vuchar16 &p, int n)
+  {
+#if defined(__SSE__)
+    return _mm_and_si128(_mm_srli_epi16(p, n),
+                         _mm_set1_epi8(char(0xff >> n)));
+#else
+    vuchar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = detail::srl1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuchar16 srl(const vuchar16 &p, const vuchar16 &n)
+  {
+    vuchar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = detail::srl1(p[i], int(n[i]));
+
+    return result;
+  }
+
+  TSIMD_INLINE vuchar16 sra(const vuchar16 &p, int n)
+  {
+#if defined(__SSE__)
+    n = n > 7 ? 7 : n;
+    const __m128i t = srl(p, n);
+    const __m128i m = _mm_set1_epi8(char(0x80 >> n));
+    return _mm_sub_epi8(_mm_xor_si128(t, m), m);
+#else
+    vuchar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = detail::sra1(p[i], n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuchar16 sra(const vuchar16 &p, const vuchar16 &n)
+  {
+    vuchar16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = detail::sra1(p[i], int(n[i]));
+
+    return result;
+  }
+
+  TSIMD_INLINE vshort16 srl(const vshort16 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srli_epi16(p, n);
+#else
+    return vshort16(srl(vshort8(p.vl), n),
+                    srl(vshort8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 srl(const vshort16 &p, const vshort16 &n)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_srlv_epi16(p, n);
+#else
+    return vshort16(srl(vshort8(p.vl), vshort8(n.vl)),
+                    srl(vshort8(p.vh), vshort8(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 sra(const vshort16 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srai_epi16(p, n);
+#else
+    return vshort16(sra(vshort8(p.vl), n),
+                    sra(vshort8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 sra(const vshort16 &p, const vshort16 &n)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_srav_epi16(p, n);
+#else
+    return vshort16(sra(vshort8(p.vl), vshort8(n.vl)),
+                    sra(vshort8(p.vh), vshort8(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 srl(const vushort16 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srli_epi16(p, n);
+#else
+    return vushort16(srl(vushort8(p.vl), n),
+                     srl(vushort8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 srl(const vushort16 &p, const vushort16 &n)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_srlv_epi16(p, n);
+#else
+    return vushort16(srl(vushort8(p.vl), vushort8(n.vl)),
+                     srl(vushort8(p.vh), vushort8(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 sra(const vushort16 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srai_epi16(p, n);
+#else
+    return vushort16(sra(vushort8(p.vl), n),
+                     sra(vushort8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 sra(const vushort16 &p, const vushort16 &n)
+  {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    return _mm256_srav_epi16(p, n);
+#else
+    return vushort16(sra(vushort8(p.vl), vushort8(n.vl)),
+                     sra(vushort8(p.vh), vushort8(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vint16 srl(const vint16 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srli_epi32(p, n);
+#else
+    return vint16(srl(vint8(p.vl), n),
+                  srl(vint8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vint16 srl(const vint16 &p, const vint16 &n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srlv_epi32(p, n);
+#else
+    return vint16(srl(vint8(p.vl), vint8(n.vl)),
+                  srl(vint8(p.vh), vint8(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vint16 sra(const vint16 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srai_epi32(p, n);
+#else
+    return vint16(sra(vint8(p.vl), n),
+                  sra(vint8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vint16 sra(const vint16 &p, const vint16 &n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srav_epi32(p, n);
+#else
+    return vint16(sra(vint8(p.vl), vint8(n.vl)),
+                  sra(vint8(p.vh), vint8(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuint16 srl(const vuint16 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srli_epi32(p, n);
+#else
+    return vuint16(srl(vuint8(p.vl), n),
+                   srl(vuint8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuint16 srl(const vuint16 &p, const vuint16 &n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srlv_epi32(p, n);
+#else
+    return vuint16(srl(vuint8(p.vl), vuint8(n.vl)),
+                   srl(vuint8(p.vh), vuint8(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuint16 sra(const vuint16 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srai_epi32(p, n);
+#else
+    return vuint16(sra(vuint8(p.vl), n),
+                   sra(vuint8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuint16 sra(const vuint16 &p, const vuint16 &n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srav_epi32(p, n);
+#else
+    return vuint16(sra(vuint8(p.vl), vuint8(n.vl)),
+                   sra(vuint8(p.vh), vuint8(n.vh)));
+#endif
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE vschar32 srl(const vschar32 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(_mm256_srli_epi16(p, n),
+                            _mm256_set1_epi8(char(0xff >> n)));
+#else
+    return vschar32(srl(vschar16(p.vl), n),
+                    srl(vschar16(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vschar32 srl(const vschar32 &p, const vschar32 &n)
+  {
+    return vschar32(srl(vschar16(p.vl), vschar16(n.vl)),
+                    srl(vschar16(p.vh), vschar16(n.vh)));
+  }
+
+  TSIMD_INLINE vschar32 sra(const vschar32 &p, int n)
+  {
+#if defined(__AVX2__)
+    n = n > 7 ? 7 : n;
+    const __m256i t = srl(p, n);
+    const __m256i m = _mm256_set1_epi8(char(0x80 >> n));
+    return _mm256_sub_epi8(_mm256_xor_si256(t, m), m);
+#else
+    return vschar32(sra(vschar16(p.vl), n),
+                    sra(vschar16(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vschar32 sra(const vschar32 &p, const vschar32 &n)
+  {
+    return vschar32(sra(vschar16(p.vl), vschar16(n.vl)),
+                    sra(vschar16(p.vh), vschar16(n.vh)));
+  }
+
+  TSIMD_INLINE vuchar32 srl(const vuchar32 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_and_si256(_mm256_srli_epi16(p, n),
+                            _mm256_set1_epi8(char(0xff >> n)));
+#else
+    return vuchar32(srl(vuchar16(p.vl), n),
+                    srl(vuchar16(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 srl(const vuchar32 &p, const vuchar32 &n)
+  {
+    return vuchar32(srl(vuchar16(p.vl), vuchar16(n.vl)),
+                    srl(vuchar16(p.vh), vuchar16(n.vh)));
+  }
+
+  TSIMD_INLINE vuchar32 sra(const vuchar32 &p, int n)
+  {
+#if defined(__AVX2__)
+    n = n > 7 ? 7 : n;
+    const __m256i t = srl(p, n);
+    const __m256i m = _mm256_set1_epi8(char(0x80 >> n));
+    return _mm256_sub_epi8(_mm256_xor_si256(t, m), m);
+#else
+    return vuchar32(sra(vuchar16(p.vl), n),
+                    sra(vuchar16(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 sra(const vuchar32 &p, const vuchar32 &n)
+  {
+    return vuchar32(sra(vuchar16(p.vl), vuchar16(n.vl)),
+                    sra(vuchar16(p.vh), vuchar16(n.vh)));
+  }
+
+  TSIMD_INLINE vshort32 srl(const vshort32 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_srli_epi16(p, n);
+#else
+    return vshort32(srl(vshort16(p.vl), n),
+                    srl(vshort16(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 srl(const vshort32 &p, const vshort32 &n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_srlv_epi16(p, n);
+#else
+    return vshort32(srl(vshort16(p.vl), vshort16(n.vl)),
+                    srl(vshort16(p.vh), vshort16(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 sra(const vshort32 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_srai_epi16(p, n);
+#else
+    return vshort32(sra(vshort16(p.vl), n),
+                    sra(vshort16(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 sra(const vshort32 &p, const vshort32 &n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_srav_epi16(p, n);
+#else
+    return vshort32(sra(vshort16(p.vl), vshort16(n.vl)),
+                    sra(vshort16(p.vh), vshort16(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 srl(const vushort32 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_srli_epi16(p, n);
+#else
+    return vushort32(srl(vushort16(p.vl), n),
+                     srl(vushort16(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 srl(const vushort32 &p, const vushort32 &n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_srlv_epi16(p, n);
+#else
+    return vushort32(srl(vushort16(p.vl), vushort16(n.vl)),
+                     srl(vushort16(p.vh), vushort16(n.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 sra(const vushort32 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_srai_epi16(p, n);
+#else
+    return vushort32(sra(vushort16(p.vl), n),
+                     sra(vushort16(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 sra(const vushort32 &p, const vushort32 &n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_srav_epi16(p, n);
+#else
+    return vushort32(sra(vushort16(p.vl), vushort16(n.vl)),
+                     sra(vushort16(p.vh), vushort16(n.vh)));
+#endif
+  }
+
+  // 64-wide //
+
+  TSIMD_INLINE vschar64 srl(const vschar64 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_and_si512(_mm512_srli_epi16(p, n),
+                            _mm512_set1_epi8(char(0xff >> n)));
+#else
+    return vschar64(srl(vschar32(p.vl), n),
+                    srl(vschar32(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vschar64 srl(const vschar64 &p, const vschar64 &n)
+  {
+    return vschar64(srl(vschar32(p.vl), vschar32(n.vl)),
+                    srl(vschar32(p.vh), vschar32(n.vh)));
+  }
+
+  TSIMD_INLINE vschar64 sra(const vschar64 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    n = n > 7 ? 7 : n;
+    const __m512i t = srl(p, n);
+    const __m512i m = _mm512_set1_epi8(char(0x80 >> n));
+    return _mm512_sub_epi8(_mm512_xor_si512(t, m), m);
+#else
+    return vschar64(sra(vschar32(p.vl), n),
+                    sra(vschar32(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vschar64 sra(const vschar64 &p, const vschar64 &n)
+  {
+    return vschar64(sra(vschar32(p.vl), vschar32(n.vl)),
+                    sra(vschar32(p.vh), vschar32(n.vh)));
+  }
+
+  TSIMD_INLINE vuchar64 srl(const vuchar64 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_and_si512(_mm512_srli_epi16(p, n),
+                            _mm512_set1_epi8(char(0xff >> n)));
+#else
+    return vuchar64(srl(vuchar32(p.vl), n),
+                    srl(vuchar32(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 srl(const vuchar64 &p, const vuchar64 &n)
+  {
+    return vuchar64(srl(vuchar32(p.vl), vuchar32(n.vl)),
+                    srl(vuchar32(p.vh), vuchar32(n.vh)));
+  }
+
+  TSIMD_INLINE vuchar64 sra(const vuchar64 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    n = n > 7 ? 7 : n;
+    const __m512i t = srl(p, n);
+    const __m512i m = _mm512_set1_epi8(char(0x80 >> n));
+    return _mm512_sub_epi8(_mm512_xor_si512(t, m), m);
+#else
+    return vuchar64(sra(vuchar32(p.vl), n),
+                    sra(vuchar32(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 sra(const vuchar64 &p, const vuchar64 &n)
+  {
+    return vuchar64(sra(vuchar32(p.vl), vuchar32(n.vl)),
+                    sra(vuchar32(p.vh), vuchar32(n.vh)));
+  }
+
+  // Composite widths //
+
+  template <typename T,
+            int W,
+            typename = traits::is_integral_t<T>,
+            typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> srl(const pack<T, W> &p, int n)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(srl(half_pack(p.vl), n), srl(half_pack(p.vh), n));
+  }
+
+  template <typename T,
+            int W,
+            typename = traits::is_integral_t<T>,
+            typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> srl(const pack<T, W> &p, const pack<T, W> &n)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(srl(half_pack(p.vl), half_pack(n.vl)),
+                      srl(half_pack(p.vh), half_pack(n.vh)));
+  }
+
+  template <typename T,
+            int W,
+            typename = traits::is_integral_t<T>,
+            typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> sra(const pack<T, W> &p, int n)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(sra(half_pack(p.vl), n), sra(half_pack(p.vh), n));
+  }
+
+  template <typename T,
+            int W,
+            typename = traits::is_integral_t<T>,
+            typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> sra(const pack<T, W> &p, const pack<T, W> &n)
+  {
+    using half_pack = pack<T, W / 2>;
+    return pack<T, W>(sra(half_pack(p.vl), half_pack(n.vl)),
+                      sra(half_pack(p.vh), half_pack(n.vh)));
+  }
+
+  // Inferred operators ///////////////////////////////////////////////////////
+
+  namespace detail {
+
+    template <typename T, int W, typename COUNT_T>
+    TSIMD_INLINE pack<T, W> shift_right(const pack<T, W> &p,
+                                        const COUNT_T &n,
+                                        std::true_type /*is_signed*/)
+    {
+      return sra(p, n);
+    }
+
+    template <typename T, int W, typename COUNT_T>
+    TSIMD_INLINE pack<T, W> shift_right(const pack<T, W> &p,
+                                        const COUNT_T &n,
+                                        std::false_type /*is_signed*/)
+    {
+      return srl(p, n);
+    }
+
+  }  // namespace detail
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> operator>>(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return detail::shift_right(p1, p2, std::is_signed<T>());
+  }
 
   template <typename T,
             int W,
@@ -50,7 +1103,7 @@ namespace tsimd {
             typename = traits::can_convert<OTHER_T, T>>
   TSIMD_INLINE pack<T, W> operator>>(const pack<T, W> &p1, const OTHER_T &v)
   {
-    return p1 >> pack<T, W>(v);
+    return detail::shift_right(p1, int(v), std::is_signed<T>());
   }
 
   template <typename T,
@@ -59,7 +1112,24 @@ namespace tsimd {
             typename = traits::can_convert<OTHER_T, T>>
   TSIMD_INLINE pack<T, W> operator>>(const OTHER_T &v, const pack<T, W> &p1)
   {
-    return pack<T, W>(v) >> p1;
+    return detail::shift_right(pack<T, W>(v), p1, std::is_signed<T>());
+  }
+
+  // Inferred binary operator>>=() ////////////////////////////////////////////
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> &operator>>=(pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return p1 = (p1 >> p2);
+  }
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename = traits::can_convert<OTHER_T, T>>
+  TSIMD_INLINE pack<T, W> &operator>>=(pack<T, W> &p1, const OTHER_T &v)
+  {
+    return p1 = (p1 >> v);
   }
 
 }  // namespace tsimd
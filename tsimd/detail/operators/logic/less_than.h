@@ -36,11 +36,47 @@ namespace tsimd {
     return mask<T, 1>(p1[0] < p2[0]);
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vboold2 operator<(const vdouble2 &p1, const vdouble2 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm_cmp_pd_mask(p1, p2, _CMP_LT_OQ);
+#elif defined(__SSE__)
+    return _mm_cmplt_pd(p1, p2);
+#else
+    vboold2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] < p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboold2 operator<(const vllong2 &p1, const vllong2 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm_cmp_epi64_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__SSE4_2__)
+    return _mm_castsi128_pd(_mm_cmpgt_epi64(p2, p1));
+#else
+    vboold2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] < p2[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vboolf4 operator<(const vfloat4 &p1, const vfloat4 &p2)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return _mm_cmp_ps_mask(p1, p2, _CMP_LT_OQ);
+#elif defined(__SSE__)
     return _mm_cmplt_ps(p1, p2);
 #else
     vboolf4 result;
@@ -54,7 +90,9 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf4 operator<(const vint4 &p1, const vint4 &p2)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return _mm_cmp_epi32_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__SSE__)
     return _mm_castsi128_ps(_mm_cmplt_epi32(p1, p2));
 #else
     vboolf4 result;
@@ -66,13 +104,53 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboolf4 operator<(const vuint4 &p1, const vuint4 &p2)
+  {
+    return p2 > p1;
+  }
+
+  TSIMD_INLINE vboold4 operator<(const vdouble4 &p1, const vdouble4 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_pd_mask(p1, p2, _CMP_LT_OQ);
+#elif defined(__AVX__)
+    return _mm256_cmp_pd(p1, p2, _CMP_LT_OQ);
+#else
+    vboold4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] < p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboold4 operator<(const vllong4 &p1, const vllong4 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_epi64_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__AVX2__)
+    return _mm256_castsi256_pd(_mm256_cmpgt_epi64(p2, p1));
+#elif defined(__AVX__)
+    return vboold4(_mm_castsi128_pd(_mm_cmpgt_epi64(p2.vl, p1.vl)),
+                   _mm_castsi128_pd(_mm_cmpgt_epi64(p2.vh, p1.vh)));
+#else
+    vboold4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] < p2[i]);
+
+    return result;
+#endif
+  }
+
   // 8-wide //
 
   TSIMD_INLINE vboolf8 operator<(const vfloat8 &p1, const vfloat8 &p2)
   {
-#if defined(__AVX512__)
-    return _mm256_cmp_ps_mask(p1, p2, _MM_CMPINT_LT);
-#elif defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return _mm256_cmp_ps_mask(p1, p2, _CMP_LT_OQ);
+#elif defined(__AVX__)
     return _mm256_cmp_ps(p1, p2, _CMP_LT_OQ);
 #else
     return vboolf8(vfloat4(p1.vl) < vfloat4(p2.vl),
@@ -82,7 +160,9 @@ namespace tsimd {
 
   TSIMD_INLINE vboolf8 operator<(const vint8 &p1, const vint8 &p2)
   {
-#if defined(__AVX512__) || defined(__AVX2__)
+#if defined(__AVX512VL__)
+    return _mm256_cmp_epi32_mask(p1, p2, _MM_CMPINT_LT);
+#elif defined(__AVX2__)
     return _mm256_castsi256_ps(_mm256_cmpgt_epi32(p2, p1));
 #elif defined(__AVX__)
     return vboolf8(_mm_castsi128_ps(_mm_cmplt_epi32(p1.vl, p2.vl)),
@@ -92,12 +172,56 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboolf8 operator<(const vuint8 &p1, const vuint8 &p2)
+  {
+    return p2 > p1;
+  }
+
+  TSIMD_INLINE vboold8 operator<(const vdouble8 &p1, const vdouble8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cmp_pd_mask(p1, p2, _CMP_LT_OQ);
+#else
+    return vboold8(vdouble4(p1.vl) < vdouble4(p2.vl),
+                   vdouble4(p1.vh) < vdouble4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboold8 operator<(const vllong8 &p1, const vllong8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cmp_epi64_mask(p1, p2, _MM_CMPINT_LT);
+#else
+    return vboold8(vllong4(p1.vl) < vllong4(p2.vl),
+                   vllong4(p1.vh) < vllong4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolw8 operator<(const vshort8 &p1, const vshort8 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_cmplt_epi16(p1, p2);
+#else
+    vboolw8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = (p1[i] < p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboolw8 operator<(const vushort8 &p1, const vushort8 &p2)
+  {
+    return p2 > p1;
+  }
+
   // 16-wide //
 
   TSIMD_INLINE vboolf16 operator<(const vfloat16 &p1, const vfloat16 &p2)
   {
 #if defined(__AVX512F__)
-    return _mm512_cmp_ps_mask(p1, p2, _MM_CMPINT_LT);
+    return _mm512_cmp_ps_mask(p1, p2, _CMP_LT_OQ);
 #else
     return vboolf16(vfloat8(p1.vl) < vfloat8(p2.vl),
                     vfloat8(p1.vh) < vfloat8(p2.vh));
@@ -113,6 +237,114 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboolf16 operator<(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cmp_epu32_mask(p1, p2, _MM_CMPINT_LT);
+#else
+    return p2 > p1;
+#endif
+  }
+
+  TSIMD_INLINE vboolb16 operator<(const vschar16 &p1, const vschar16 &p2)
+  {
+#if defined(__SSE__)
+    return _mm_cmplt_epi8(p1, p2);
+#else
+    vboolb16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = (p1[i] < p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboolb16 operator<(const vuchar16 &p1, const vuchar16 &p2)
+  {
+    return p2 > p1;
+  }
+
+  TSIMD_INLINE vboolw16 operator<(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_cmpgt_epi16(p2, p1);
+#else
+    return vboolw16(vshort8(p1.vl) < vshort8(p2.vl),
+                    vshort8(p1.vh) < vshort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolw16 operator<(const vushort16 &p1, const vushort16 &p2)
+  {
+    return p2 > p1;
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE vboolb32 operator<(const vschar32 &p1, const vschar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_cmpgt_epi8(p2, p1);
+#else
+    return vboolb32(vschar16(p1.vl) < vschar16(p2.vl),
+                    vschar16(p1.vh) < vschar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolb32 operator<(const vuchar32 &p1, const vuchar32 &p2)
+  {
+    return p2 > p1;
+  }
+
+  TSIMD_INLINE vboolw32 operator<(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi16(_mm512_cmplt_epi16_mask(p1, p2));
+#else
+    return p2 > p1;
+#endif
+  }
+
+  TSIMD_INLINE vboolw32 operator<(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi16(_mm512_cmplt_epu16_mask(p1, p2));
+#else
+    return p2 > p1;
+#endif
+  }
+
+  // 64-wide //
+
+  TSIMD_INLINE vboolb64 operator<(const vschar64 &p1, const vschar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi8(_mm512_cmplt_epi8_mask(p1, p2));
+#else
+    return p2 > p1;
+#endif
+  }
+
+  TSIMD_INLINE vboolb64 operator<(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi8(_mm512_cmplt_epu8_mask(p1, p2));
+#else
+    return p2 > p1;
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename T, int W, typename = traits::has_halves_t<W>>
+  TSIMD_INLINE mask<T, W> operator<(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_pack = pack<T, W / 2>;
+    return mask<T, W>(half_pack(p1.vl) < half_pack(p2.vl),
+                      half_pack(p1.vh) < half_pack(p2.vh));
+  }
+
   // Inferred pack-scalar operators ///////////////////////////////////////////
 
   template <typename T,
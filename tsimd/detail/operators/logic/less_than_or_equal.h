@@ -39,11 +39,45 @@ namespace tsimd {
     return mask<T, 1>(p1[0] <= p2[0]);
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vboold2 operator<=(const vdouble2 &p1, const vdouble2 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm_cmp_pd_mask(p1, p2, _CMP_LE_OQ);
+#elif defined(__SSE__)
+    return _mm_cmple_pd(p1, p2);
+#else
+    vboold2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] <= p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboold2 operator<=(const vllong2 &p1, const vllong2 &p2)
+  {
+#if defined(__SSE4_2__)
+    return !(p1 > p2);
+#else
+    vboold2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] <= p2[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vboolf4 operator<=(const vfloat4 &p1, const vfloat4 &p2)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return _mm_cmp_ps_mask(p1, p2, _CMP_LE_OQ);
+#elif defined(__SSE__)
     return _mm_cmple_ps(p1, p2);
 #else
     vboolf4 result;
@@ -60,12 +94,47 @@ namespace tsimd {
     return !(p1 > p2);
   }
 
+  TSIMD_INLINE vboolf4 operator<=(const vuint4 &p1, const vuint4 &p2)
+  {
+    return !(p1 > p2);
+  }
+
+  TSIMD_INLINE vboold4 operator<=(const vdouble4 &p1, const vdouble4 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_pd_mask(p1, p2, _CMP_LE_OQ);
+#elif defined(__AVX__)
+    return _mm256_cmp_pd(p1, p2, _CMP_LE_OQ);
+#else
+    vboold4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] <= p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboold4 operator<=(const vllong4 &p1, const vllong4 &p2)
+  {
+#if defined(__AVX__)
+    return !(p1 > p2);
+#else
+    vboold4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] <= p2[i]);
+
+    return result;
+#endif
+  }
+
   // 8-wide //
 
   TSIMD_INLINE vboolf8 operator<=(const vfloat8 &p1, const vfloat8 &p2)
   {
 #if defined(__AVX512VL__)
-    return _mm256_cmp_ps_mask(p1, p2, _MM_CMPINT_LE);
+    return _mm256_cmp_ps_mask(p1, p2, _CMP_LE_OQ);
 #elif defined(__AVX2__) || defined(__AVX__)
     return _mm256_cmp_ps(p1, p2, _CMP_LE_OQ);
 #else
@@ -85,12 +154,47 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboolf8 operator<=(const vuint8 &p1, const vuint8 &p2)
+  {
+    return !(p1 > p2);
+  }
+
+  TSIMD_INLINE vboold8 operator<=(const vdouble8 &p1, const vdouble8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cmp_pd_mask(p1, p2, _CMP_LE_OQ);
+#else
+    return vboold8(vdouble4(p1.vl) <= vdouble4(p2.vl),
+                   vdouble4(p1.vh) <= vdouble4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboold8 operator<=(const vllong8 &p1, const vllong8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cmp_epi64_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return vboold8(vllong4(p1.vl) <= vllong4(p2.vl),
+                   vllong4(p1.vh) <= vllong4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolw8 operator<=(const vshort8 &p1, const vshort8 &p2)
+  {
+    return !(p1 > p2);
+  }
+
+  TSIMD_INLINE vboolw8 operator<=(const vushort8 &p1, const vushort8 &p2)
+  {
+    return !(p1 > p2);
+  }
+
   // 16-wide //
 
   TSIMD_INLINE vboolf16 operator<=(const vfloat16 &p1, const vfloat16 &p2)
   {
 #if defined(__AVX512F__)
-    return _mm512_cmp_ps_mask(p1, p2, _MM_CMPINT_LE);
+    return _mm512_cmp_ps_mask(p1, p2, _CMP_LE_OQ);
 #else
     return vboolf16(vfloat8(p1.vl) <= vfloat8(p2.vl),
                     vfloat8(p1.vh) <= vfloat8(p2.vh));
@@ -106,6 +210,95 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboolf16 operator<=(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cmp_epu32_mask(p1, p2, _MM_CMPINT_LE);
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vboolb16 operator<=(const vschar16 &p1, const vschar16 &p2)
+  {
+    return !(p1 > p2);
+  }
+
+  TSIMD_INLINE vboolb16 operator<=(const vuchar16 &p1, const vuchar16 &p2)
+  {
+    return !(p1 > p2);
+  }
+
+  TSIMD_INLINE vboolw16 operator<=(const vshort16 &p1, const vshort16 &p2)
+  {
+    return !(p1 > p2);
+  }
+
+  TSIMD_INLINE vboolw16 operator<=(const vushort16 &p1, const vushort16 &p2)
+  {
+    return !(p1 > p2);
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE vboolb32 operator<=(const vschar32 &p1, const vschar32 &p2)
+  {
+    return !(p1 > p2);
+  }
+
+  TSIMD_INLINE vboolb32 operator<=(const vuchar32 &p1, const vuchar32 &p2)
+  {
+    return !(p1 > p2);
+  }
+
+  TSIMD_INLINE vboolw32 operator<=(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi16(_mm512_cmple_epi16_mask(p1, p2));
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vboolw32 operator<=(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi16(_mm512_cmple_epu16_mask(p1, p2));
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  // 64-wide //
+
+  TSIMD_INLINE vboolb64 operator<=(const vschar64 &p1, const vschar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi8(_mm512_cmple_epi8_mask(p1, p2));
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  TSIMD_INLINE vboolb64 operator<=(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi8(_mm512_cmple_epu8_mask(p1, p2));
+#else
+    return !(p1 > p2);
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename T, int W, typename = traits::has_halves_t<W>>
+  TSIMD_INLINE mask<T, W> operator<=(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_pack = pack<T, W / 2>;
+    return mask<T, W>(half_pack(p1.vl) <= half_pack(p2.vl),
+                      half_pack(p1.vh) <= half_pack(p2.vh));
+  }
+
   // Inferred pack-scalar operators ///////////////////////////////////////////
 
   template <typename T,
@@ -31,16 +31,36 @@ namespace tsimd {
   // 1-wide //
 
   template <typename T, typename = traits::is_bool_t<T>>
-  TSIMD_INLINE mask<T, 1> operator!(const mask<T, 1> &m)
+  TSIMD_INLINE pack<T, 1> operator!(const pack<T, 1> &m)
   {
-    return mask<T, 1>(!m[0]);
+    return pack<T, 1>(!m[0]);
+  }
+
+  // 2-wide //
+
+  TSIMD_INLINE vboold2 operator!(const vboold2 &m)
+  {
+#if defined(__AVX512VL__)
+    return __mmask8(~m.v & 0x3);
+#elif defined(__SSE__)
+    return _mm_xor_pd(m, vboold2(true));
+#else
+    vboold2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = !m[i];
+
+    return result;
+#endif
   }
 
   // 4-wide //
 
   TSIMD_INLINE vboolf4 operator!(const vboolf4 &m)
   {
-#if defined(__SSE__)
+#if defined(__AVX512VL__)
+    return __mmask8(~m.v & 0xf);
+#elif defined(__SSE__)
     return _mm_xor_ps(m, vboolf4(true));
 #else
     vboolf4 result;
@@ -52,17 +72,58 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboold4 operator!(const vboold4 &m)
+  {
+#if defined(__AVX512VL__)
+    return __mmask8(~m.v & 0xf);
+#elif defined(__AVX__)
+    return _mm256_xor_pd(m, vboold4(true));
+#else
+    vboold4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = !m[i];
+
+    return result;
+#endif
+  }
+
   // 8-wide //
 
   TSIMD_INLINE vboolf8 operator!(const vboolf8 &m)
   {
-#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
+#if defined(__AVX512VL__)
+    return __mmask8(~m.v);
+#elif defined(__AVX__)
     return _mm256_xor_ps(m, vboolf8(true));
 #else
     return vboolf8(!vboolf4(m.vl), !vboolf4(m.vh));
 #endif
   }
 
+  TSIMD_INLINE vboold8 operator!(const vboold8 &m)
+  {
+#if defined(__AVX512F__)
+    return _mm512_knot(m);
+#else
+    return vboold8(!vboold4(m.vl), !vboold4(m.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolw8 operator!(const vboolw8 &m)
+  {
+#if defined(__SSE__)
+    return _mm_xor_si128(m, _mm_set1_epi32(-1));
+#else
+    vboolw8 result;
+
+    for (int i = 0; i < 8; ++i)
+      result[i] = !m[i];
+
+    return result;
+#endif
+  }
+
   // 16-wide //
 
   TSIMD_INLINE vboolf16 operator!(const vboolf16 &m)
@@ -74,4 +135,70 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboolb16 operator!(const vboolb16 &m)
+  {
+#if defined(__SSE__)
+    return _mm_xor_si128(m, _mm_set1_epi32(-1));
+#else
+    vboolb16 result;
+
+    for (int i = 0; i < 16; ++i)
+      result[i] = !m[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboolw16 operator!(const vboolw16 &m)
+  {
+#if defined(__AVX2__)
+    return _mm256_xor_si256(m, _mm256_set1_epi32(-1));
+#else
+    return vboolw16(!vboolw8(m.vl), !vboolw8(m.vh));
+#endif
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE vboolb32 operator!(const vboolb32 &m)
+  {
+#if defined(__AVX2__)
+    return _mm256_xor_si256(m, _mm256_set1_epi32(-1));
+#else
+    return vboolb32(!vboolb16(m.vl), !vboolb16(m.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolw32 operator!(const vboolw32 &m)
+  {
+#if defined(__AVX512F__)
+    return _mm512_xor_si512(m, _mm512_set1_epi32(-1));
+#else
+    return vboolw32(!vboolw16(m.vl), !vboolw16(m.vh));
+#endif
+  }
+
+  // 64-wide //
+
+  TSIMD_INLINE vboolb64 operator!(const vboolb64 &m)
+  {
+#if defined(__AVX512F__)
+    return _mm512_xor_si512(m, _mm512_set1_epi32(-1));
+#else
+    return vboolb64(!vboolb32(m.vl), !vboolb32(m.vh));
+#endif
+  }
+
+  // Composite widths //
+
+  template <typename T,
+            int W,
+            typename = traits::is_bool_t<T>,
+            typename = traits::has_halves_t<W>>
+  TSIMD_INLINE pack<T, W> operator!(const pack<T, W> &m)
+  {
+    using half_mask = pack<T, W / 2>;
+    return pack<T, W>(!half_mask(m.vl), !half_mask(m.vh));
+  }
+
 }  // namespace tsimd
\ No newline at end of file
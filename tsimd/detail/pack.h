@@ -38,6 +38,49 @@ namespace tsimd {
   template <typename OTHER_T, typename T, int W>
   pack<OTHER_T, W> convert_elements_to(const pack<T, W> &from);
 
+  namespace detail {
+
+    // NOTE: k-register masks hold one bit per element, so writing elements
+    //       goes through this proxy instead of a boolN_t reference
+
+    template <typename T, int W>
+    struct kmask_reference
+    {
+      using bits_t = typename traits::simd_type<T, W>::type;
+
+      TSIMD_INLINE kmask_reference(bits_t &_bits, int _i) : bits(_bits), i(_i)
+      {
+      }
+
+      TSIMD_INLINE operator bool() const
+      {
+        return (bits >> i) & 1;
+      }
+
+      TSIMD_INLINE kmask_reference &operator=(bool b)
+      {
+        const bits_t bit = bits_t(bits_t(1) << i);
+        bits             = b ? bits_t(bits | bit) : bits_t(bits & ~bit);
+        return *this;
+      }
+
+      TSIMD_INLINE kmask_reference &operator=(const kmask_reference &other)
+      {
+        return *this = bool(other);
+      }
+
+      bits_t &bits;
+      int i;
+    };
+
+    // How the elements of a pack<> are stored //
+
+    using array_elements      = std::integral_constant<int, 0>;
+    using kmask_elements      = std::integral_constant<int, 1>;
+    using kmask_half_elements = std::integral_constant<int, 2>;
+
+  }  // namespace detail
+
   template <typename T, int W>
   struct pack
   {
@@ -52,11 +95,39 @@ namespace tsimd {
     using half_intrinsic_t = typename traits::half_simd_type<value_t, W>::type;
     using cast_intrinsic_t = typename traits::cast_simd_type<value_t, W>::type;
 
+    // NOTE: elements are bits of k-register masks, either v itself or the
+    //       halves of a composite mask (ex: vboolf32 on AVX-512)
+    using kmask_width =
+        std::integral_constant<int, traits::kmask_width<value_t, W>::value>;
+    using is_kmask = std::integral_constant<bool, kmask_width::value != 0>;
+    using element_storage = std::integral_constant<
+        int,
+        kmask_width::value == 0
+            ? detail::array_elements::value
+            : (kmask_width::value == W ? detail::kmask_elements::value
+                                       : detail::kmask_half_elements::value)>;
+
+    using reference = typename std::conditional<
+        is_kmask::value,
+        detail::kmask_reference<value_t, kmask_width::value>,
+        T &>::type;
+    using const_reference =
+        typename std::conditional<is_kmask::value, T, const T &>::type;
+
     // Construction //
 
     pack() = default;
     explicit pack(T value);
 
+    // NOTE: a k-register mask's intrinsic_t is an integer, which would
+    //       otherwise win overload resolution for pack(true)
+    template <typename B,
+              typename = traits::enable_if_t<is_kmask::value &&
+                                             std::is_same<B, bool>::value>>
+    explicit pack(B value) : pack(T(value))
+    {
+    }
+
     template <typename OT, typename = traits::is_not_same_t<T, OT>>
     explicit pack(const pack<OT, W> &other)
     {
@@ -71,18 +142,17 @@ namespace tsimd {
     // (ugly syntax here) --> construct from 2 x half_intrinsic_t by value
     // NOTE(jda) - must define here because of MSVC...
     template <typename IT = half_intrinsic_t>
-    pack(traits::enable_if_t<!traits::half_simd_is_array<T, W>::value, IT> a,
+    pack(traits::enable_if_t<traits::has_halves<W>::value, IT> a,
          half_intrinsic_t b) : vl(a), vh(b) {}
 
-    explicit pack(const std::array<T, W / 2> &a, const std::array<T, W / 2> &b);
     explicit pack(const std::array<T, W> &arr);
 
     pack<T, W> &operator=(const value_t &);
 
     // Array access //
 
-    const T &operator[](int i) const;
-    T &operator[](int i);
+    const_reference operator[](int i) const;
+    reference operator[](int i);
 
     // Cast //
 
@@ -130,11 +200,12 @@ namespace tsimd {
     // Interface checks //
 
     static_assert(traits::valid_type_for_pack<T>::value,
-                  "pack 'T' type currently must be 'float', 'int', 'double',"
-                  " 'long long', 'bool32_t', or 'bool64_t'!");
+                  "pack 'T' type currently must be 'float', 'int',"
+                  " 'unsigned int', 'double', 'long long', 'int8_t',"
+                  " 'uint8_t', 'int16_t', 'uint16_t', or a boolN_t!");
 
-    static_assert(W == 1 || W == 4 || W == 8 || W == 16,
-                  "pack 'W' size must be 1, 4, 8, or 16!");
+    static_assert(traits::valid_width_for_pack<T, W>::value,
+                  "pack 'W' size must be a power of two!");
   };
 
   // mask types and true/false value aliases //////////////////////////////////
@@ -151,6 +222,12 @@ namespace tsimd {
   template <int W = TSIMD_DEFAULT_WIDTH>
   using maskd = pack<bool64_t, W>;
 
+  template <int W>
+  using maskb = pack<bool8_t, W>;
+
+  template <int W>
+  using maskw = pack<bool16_t, W>;
+
   // Mask type for a given pack ///////////////////////////////////////////////
 
   template <typename MASK_T>
@@ -174,6 +251,14 @@ namespace tsimd {
   template <int W> using vllongn  = pack<long long, W>;
   template <int W> using vbooldn  = maskd<W>;
 
+  template <int W> using vscharn  = pack<int8_t, W>;
+  template <int W> using vucharn  = pack<uint8_t, W>;
+  template <int W> using vboolbn  = maskb<W>;
+
+  template <int W> using vshortn  = pack<int16_t, W>;
+  template <int W> using vushortn = pack<uint16_t, W>;
+  template <int W> using vboolwn  = maskw<W>;
+
   /* 1-wide shortcuts */
   using vfloat1  = vfloatn<1>;
   using vint1    = vintn<1>;
@@ -184,6 +269,24 @@ namespace tsimd {
   using vdouble1 = vdoublen<1>;
   using vboold1  = maskd<1>;
 
+  using vschar1  = vscharn<1>;
+  using vuchar1  = vucharn<1>;
+  using vboolb1  = maskb<1>;
+
+  using vshort1  = vshortn<1>;
+  using vushort1 = vushortn<1>;
+  using vboolw1  = maskw<1>;
+
+  /* 2-wide shortcuts */
+  using vfloat2  = vfloatn<2>;
+  using vint2    = vintn<2>;
+  using vuint2   = vuintn<2>;
+  using vboolf2  = maskf<2>;
+
+  using vdouble2 = vdoublen<2>;
+  using vllong2  = vllongn<2>;
+  using vboold2  = maskd<2>;
+
   /* 4-wide shortcuts */
   using vfloat4  = vfloatn<4>;
   using vint4    = vintn<4>;
@@ -204,6 +307,10 @@ namespace tsimd {
   using vllong8  = vllongn<8>;
   using vboold8  = maskd<8>;
 
+  using vshort8  = vshortn<8>;
+  using vushort8 = vushortn<8>;
+  using vboolw8  = maskw<8>;
+
   /* 16-wide shortcuts */
   using vfloat16  = vfloatn<16>;
   using vint16    = vintn<16>;
@@ -214,6 +321,50 @@ namespace tsimd {
   using vllong16  = vllongn<16>;
   using vboold16  = maskd<16>;
 
+  using vschar16  = vscharn<16>;
+  using vuchar16  = vucharn<16>;
+  using vboolb16  = maskb<16>;
+
+  using vshort16  = vshortn<16>;
+  using vushort16 = vushortn<16>;
+  using vboolw16  = maskw<16>;
+
+  /* 32-wide shortcuts */
+  using vfloat32  = vfloatn<32>;
+  using vint32    = vintn<32>;
+  using vuint32   = vuintn<32>;
+  using vboolf32  = maskf<32>;
+
+  using vdouble32 = vdoublen<32>;
+  using vllong32  = vllongn<32>;
+  using vboold32  = maskd<32>;
+
+  using vschar32  = vscharn<32>;
+  using vuchar32  = vucharn<32>;
+  using vboolb32  = maskb<32>;
+
+  using vshort32  = vshortn<32>;
+  using vushort32 = vushortn<32>;
+  using vboolw32  = maskw<32>;
+
+  /* 64-wide shortcuts */
+  using vfloat64  = vfloatn<64>;
+  using vint64    = vintn<64>;
+  using vuint64   = vuintn<64>;
+  using vboolf64  = maskf<64>;
+
+  using vdouble64 = vdoublen<64>;
+  using vllong64  = vllongn<64>;
+  using vboold64  = maskd<64>;
+
+  using vschar64  = vscharn<64>;
+  using vuchar64  = vucharn<64>;
+  using vboolb64  = maskb<64>;
+
+  using vshort64  = vshortn<64>;
+  using vushort64 = vushortn<64>;
+  using vboolw64  = maskw<64>;
+
   /* default shortcuts */
   using vfloat  = vfloatn<TSIMD_DEFAULT_WIDTH>;
   using vint    = vintn<TSIMD_DEFAULT_WIDTH>;
@@ -224,25 +375,98 @@ namespace tsimd {
   using vdouble = vdoublen<TSIMD_DEFAULT_WIDTH / 2>;
   using vllong  = vllongn<TSIMD_DEFAULT_WIDTH / 2>;
   using vboold  = maskd<TSIMD_DEFAULT_WIDTH / 2>;
+
+  using vschar  = vscharn<TSIMD_DEFAULT_WIDTH * 4>;
+  using vuchar  = vucharn<TSIMD_DEFAULT_WIDTH * 4>;
+  using vboolb  = maskb<TSIMD_DEFAULT_WIDTH * 4>;
+
+  using vshort  = vshortn<TSIMD_DEFAULT_WIDTH * 2>;
+  using vushort = vushortn<TSIMD_DEFAULT_WIDTH * 2>;
+  using vboolw  = maskw<TSIMD_DEFAULT_WIDTH * 2>;
 #else
   using vdouble = vdouble1;
   using vllong  = vllong1;
-  using vboold  = maskd1;
+  using vboold  = vboold1;
+
+  using vschar  = vschar1;
+  using vuchar  = vuchar1;
+  using vboolb  = vboolb1;
+
+  using vshort  = vshort1;
+  using vushort = vushort1;
+  using vboolw  = vboolw1;
 #endif
 
   // pack<> inlined members ///////////////////////////////////////////////////
 
   // pack<>::pack(T value) + specializations //
 
+  namespace detail {
+
+    template <typename PACK_T>
+    TSIMD_INLINE void fill(PACK_T &p,
+                           typename PACK_T::value_t value,
+                           array_elements)
+    {
+#if TSIMD_USE_OPENMP
+#  pragma omp simd
+#endif
+      for (int i = 0; i < PACK_T::static_size; ++i)
+        p.arr[i] = value;
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void fill(PACK_T &p,
+                           typename PACK_T::value_t value,
+                           kmask_elements)
+    {
+      p.v = typename PACK_T::intrinsic_t();
+      for (int i = 0; i < PACK_T::static_size; ++i)
+        p[i] = value;
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE void fill(PACK_T &p,
+                           typename PACK_T::value_t value,
+                           kmask_half_elements)
+    {
+      using half_t = pack<typename PACK_T::value_t, PACK_T::static_size / 2>;
+      const half_t half(value);
+      p.vl = half;
+      p.vh = half;
+    }
+
+  }  // namespace detail
+
   template <typename T, int W>
   TSIMD_INLINE pack<T, W>::pack(T value)
   {
-#if TSIMD_USE_OPENMP
-#  pragma omp simd
+    detail::fill(*this, value, element_storage());
+  }
+
+  // 2-wide //
+
+#if defined(__SSE__)
+  template <>
+  TSIMD_INLINE vdouble2::pack(double value)
+      : v(_mm_set1_pd(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vllong2::pack(long long value)
+      : v(_mm_set1_epi64x(value))
+  {
+  }
 #endif
-    for (int i = 0; i < W; ++i)
-      arr[i] = value;
+
+#if defined(__AVX512VL__)
+  template <>
+  TSIMD_INLINE vboold2::pack(bool64_t value)
+      : v(value ? 0x3 : 0x0)
+  {
   }
+#endif
 
   // 4-wide //
 
@@ -258,6 +482,40 @@ namespace tsimd {
       : v(_mm_set1_epi32(value))
   {
   }
+
+  template <>
+  TSIMD_INLINE vuint4::pack(unsigned int value)
+      : v(_mm_set1_epi32(value))
+  {
+  }
+#endif
+
+#if defined(__AVX__)
+  template <>
+  TSIMD_INLINE vdouble4::pack(double value)
+      : v(_mm256_set1_pd(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vllong4::pack(long long value)
+      : v(_mm256_set1_epi64x(value))
+  {
+  }
+#endif
+
+#if defined(__AVX512VL__)
+  template <>
+  TSIMD_INLINE vboolf4::pack(bool32_t value)
+      : v(value ? 0xf : 0x0)
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vboold4::pack(bool64_t value)
+      : v(value ? 0xf : 0x0)
+  {
+  }
 #endif
 
   // 8-wide //
@@ -274,6 +532,56 @@ namespace tsimd {
       : v(_mm256_set1_epi32(value))
   {
   }
+
+  template <>
+  TSIMD_INLINE vuint8::pack(unsigned int value)
+      : v(_mm256_set1_epi32(value))
+  {
+  }
+#endif
+
+#if defined(__AVX512F__)
+  template <>
+  TSIMD_INLINE vdouble8::pack(double value)
+      : v(_mm512_set1_pd(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vllong8::pack(long long value)
+      : v(_mm512_set1_epi64(value))
+  {
+  }
+#endif
+
+#if defined(__SSE__)
+  template <>
+  TSIMD_INLINE vshort8::pack(int16_t value)
+      : v(_mm_set1_epi16(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vushort8::pack(uint16_t value)
+      : v(_mm_set1_epi16(value))
+  {
+  }
+#endif
+
+#if defined(__AVX512F__)
+  template <>
+  TSIMD_INLINE vboold8::pack(bool64_t value)
+      : v(value ? 0xff : 0x0)
+  {
+  }
+#endif
+
+#if defined(__AVX512VL__)
+  template <>
+  TSIMD_INLINE vboolf8::pack(bool32_t value)
+      : v(value ? 0xff : 0x0)
+  {
+  }
 #endif
 
   // 16-wide //
@@ -290,24 +598,106 @@ namespace tsimd {
       : v(_mm512_set1_epi32(value))
   {
   }
+
+  template <>
+  TSIMD_INLINE vuint16::pack(unsigned int value)
+      : v(_mm512_set1_epi32(value))
+  {
+  }
 #endif
 
-  // Generic pack<> members //
+#if defined(__SSE__)
+  template <>
+  TSIMD_INLINE vschar16::pack(int8_t value)
+      : v(_mm_set1_epi8(value))
+  {
+  }
 
-  template <typename T, int W>
-  TSIMD_INLINE pack<T, W>::pack(const std::array<T, W> &_arr) : arr(_arr)
+  template <>
+  TSIMD_INLINE vuchar16::pack(uint8_t value)
+      : v(_mm_set1_epi8(value))
   {
   }
+#endif
+
+#if defined(__AVX__)
+  template <>
+  TSIMD_INLINE vshort16::pack(int16_t value)
+      : v(_mm256_set1_epi16(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vushort16::pack(uint16_t value)
+      : v(_mm256_set1_epi16(value))
+  {
+  }
+#endif
+
+#if defined(__AVX512F__)
+  template <>
+  TSIMD_INLINE vboolf16::pack(bool32_t value)
+      : v(value ? 0xffff : 0x0)
+  {
+  }
+#endif
+
+  // 32-wide //
+
+#if defined(__AVX__)
+  template <>
+  TSIMD_INLINE vschar32::pack(int8_t value)
+      : v(_mm256_set1_epi8(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vuchar32::pack(uint8_t value)
+      : v(_mm256_set1_epi8(value))
+  {
+  }
+#endif
+
+#if defined(__AVX512F__)
+  template <>
+  TSIMD_INLINE vshort32::pack(int16_t value)
+      : v(_mm512_set1_epi16(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vushort32::pack(uint16_t value)
+      : v(_mm512_set1_epi16(value))
+  {
+  }
+#endif
+
+  // 64-wide //
+
+#if defined(__AVX512F__)
+  template <>
+  TSIMD_INLINE vschar64::pack(int8_t value)
+      : v(_mm512_set1_epi8(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vuchar64::pack(uint8_t value)
+      : v(_mm512_set1_epi8(value))
+  {
+  }
+#endif
+
+  // Generic pack<> members //
 
   template <typename T, int W>
-  TSIMD_INLINE pack<T, W>::pack(const std::array<T, W / 2> &a,
-                                const std::array<T, W / 2> &b)
+  TSIMD_INLINE pack<T, W>::pack(const std::array<T, W> &_arr) : arr(_arr)
   {
-    int i = 0;
-    for (int j = 0; j < W / 2; j++, i++)
-      arr[i] = a[j];
-    for (int j = 0; j < W / 2; j++, i++)
-      arr[i] = b[j];
+    if (is_kmask::value) {
+      *this = pack<T, W>(T(false));
+      for (int i = 0; i < W; ++i)
+        (*this)[i] = _arr[i];
+    }
   }
 
   template <typename T, int W>
@@ -317,16 +707,105 @@ namespace tsimd {
     return *this;
   }
 
+  namespace detail {
+
+    // NOTE: a half of a composite k-register mask is either the raw mask
+    //       bits or a pack<> made of further halves
+
+    template <typename T, int W>
+    TSIMD_INLINE T
+    half_element(const typename traits::simd_type<T, W>::type &bits, int i)
+    {
+      return T(((bits >> i) & 1) != 0);
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE T half_element(const pack<T, W> &half, int i)
+    {
+      return half[i];
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE kmask_reference<T, W> half_element(
+        typename traits::simd_type<T, W>::type &bits, int i)
+    {
+      return kmask_reference<T, W>(bits, i);
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE typename pack<T, W>::reference half_element(pack<T, W> &half,
+                                                             int i)
+    {
+      return half[i];
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE typename PACK_T::const_reference element(const PACK_T &p,
+                                                          int i,
+                                                          array_elements)
+    {
+      return p.arr[i];
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE typename PACK_T::const_reference element(const PACK_T &p,
+                                                          int i,
+                                                          kmask_elements)
+    {
+      return typename PACK_T::value_t(((p.v >> i) & 1) != 0);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE typename PACK_T::const_reference element(const PACK_T &p,
+                                                          int i,
+                                                          kmask_half_elements)
+    {
+      using T          = typename PACK_T::value_t;
+      constexpr int HW = PACK_T::static_size / 2;
+      return i < HW ? half_element<T, HW>(p.vl, i)
+                    : half_element<T, HW>(p.vh, i - HW);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE typename PACK_T::reference element(PACK_T &p,
+                                                    int i,
+                                                    array_elements)
+    {
+      return p.arr[i];
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE typename PACK_T::reference element(PACK_T &p,
+                                                    int i,
+                                                    kmask_elements)
+    {
+      return typename PACK_T::reference(p.v, i);
+    }
+
+    template <typename PACK_T>
+    TSIMD_INLINE typename PACK_T::reference element(PACK_T &p,
+                                                    int i,
+                                                    kmask_half_elements)
+    {
+      using T          = typename PACK_T::value_t;
+      constexpr int HW = PACK_T::static_size / 2;
+      return i < HW ? half_element<T, HW>(p.vl, i)
+                    : half_element<T, HW>(p.vh, i - HW);
+    }
+
+  }  // namespace detail
+
   template <typename T, int W>
-  TSIMD_INLINE const T &pack<T, W>::operator[](int i) const
+  TSIMD_INLINE typename pack<T, W>::const_reference pack<T, W>::
+  operator[](int i) const
   {
-    return arr[i];
+    return detail::element(*this, i, element_storage());
   }
 
   template <typename T, int W>
-  TSIMD_INLINE T &pack<T, W>::operator[](int i)
+  TSIMD_INLINE typename pack<T, W>::reference pack<T, W>::operator[](int i)
   {
-    return arr[i];
+    return detail::element(*this, i, element_storage());
   }
 
   template <typename T, int W>
@@ -428,8 +907,8 @@ namespace tsimd {
   {
     o << "{";
 
-    for (const auto &v : p)
-      o << " " << v;
+    for (int i = 0; i < W; ++i)
+      o << " " << p[i];
 
     o << " }";
 
@@ -458,6 +937,412 @@ namespace tsimd {
     return to;
   }
 
+  // unsigned int <--> float conversions //
+
+  // NOTE(jda) - Without native unsigned conversions (AVX512), unsigned values
+  //             are converted as two exact 16-bit halves, and floats >= 2^31
+  //             are offset by 2^31 before the signed conversion.
+
+  // 4-wide //
+
+  template <>
+  TSIMD_INLINE vfloat4 convert_elements_to<float>(const vuint4 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm_cvtepu32_ps(from);
+#elif defined(__SSE__)
+    const __m128i lo = _mm_and_si128(from, _mm_set1_epi32(0xffff));
+    const __m128i hi = _mm_srli_epi32(from, 16);
+    return _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(hi), _mm_set1_ps(65536.f)),
+                      _mm_cvtepi32_ps(lo));
+#else
+    vfloat4 to;
+
+    for (int i = 0; i < 4; ++i)
+      to[i] = from[i];
+
+    return to;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint4 convert_elements_to<unsigned int>(const vfloat4 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm_cvttps_epu32(from);
+#elif defined(__SSE__)
+    const __m128 two31 = _mm_set1_ps(2147483648.f);
+    const __m128 big   = _mm_cmpge_ps(from, two31);
+    const __m128i i =
+        _mm_cvttps_epi32(_mm_sub_ps(from, _mm_and_ps(big, two31)));
+    return _mm_xor_si128(i, _mm_slli_epi32(_mm_castps_si128(big), 31));
+#else
+    vuint4 to;
+
+    for (int i = 0; i < 4; ++i)
+      to[i] = from[i];
+
+    return to;
+#endif
+  }
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE vfloat8 convert_elements_to<float>(const vuint8 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cvtepu32_ps(from);
+#elif defined(__AVX2__)
+    const __m256i lo = _mm256_and_si256(from, _mm256_set1_epi32(0xffff));
+    const __m256i hi = _mm256_srli_epi32(from, 16);
+    return _mm256_add_ps(
+        _mm256_mul_ps(_mm256_cvtepi32_ps(hi), _mm256_set1_ps(65536.f)),
+        _mm256_cvtepi32_ps(lo));
+#else
+    return vfloat8(convert_elements_to<float>(vuint4(from.vl)),
+                   convert_elements_to<float>(vuint4(from.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint8 convert_elements_to<unsigned int>(const vfloat8 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cvttps_epu32(from);
+#elif defined(__AVX2__)
+    const __m256 two31 = _mm256_set1_ps(2147483648.f);
+    const __m256 big   = _mm256_cmp_ps(from, two31, _CMP_GE_OQ);
+    const __m256i i =
+        _mm256_cvttps_epi32(_mm256_sub_ps(from, _mm256_and_ps(big, two31)));
+    return _mm256_xor_si256(i, _mm256_slli_epi32(_mm256_castps_si256(big), 31));
+#else
+    return vuint8(convert_elements_to<unsigned int>(vfloat4(from.vl)),
+                  convert_elements_to<unsigned int>(vfloat4(from.vh)));
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE vfloat16 convert_elements_to<float>(const vuint16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepu32_ps(from);
+#else
+    return vfloat16(convert_elements_to<float>(vuint8(from.vl)),
+                    convert_elements_to<float>(vuint8(from.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint16 convert_elements_to<unsigned int>(const vfloat16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvttps_epu32(from);
+#else
+    return vuint16(convert_elements_to<unsigned int>(vfloat8(from.vl)),
+                   convert_elements_to<unsigned int>(vfloat8(from.vh)));
+#endif
+  }
+
+  // float <--> double conversions //
+
+  // 4-wide //
+
+  template <>
+  TSIMD_INLINE vdouble4 convert_elements_to<double>(const vfloat4 &from)
+  {
+#if defined(__AVX__)
+    return _mm256_cvtps_pd(from);
+#elif defined(__SSE2__)
+    return vdouble4(vdouble2(_mm_cvtps_pd(from)),
+                    vdouble2(_mm_cvtps_pd(_mm_movehl_ps(from, from))));
+#else
+    vdouble4 to;
+
+    for (int i = 0; i < 4; ++i)
+      to[i] = from[i];
+
+    return to;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat4 convert_elements_to<float>(const vdouble4 &from)
+  {
+#if defined(__AVX__)
+    return _mm256_cvtpd_ps(from);
+#elif defined(__SSE2__)
+    return _mm_movelh_ps(_mm_cvtpd_ps(vdouble2(from.vl)),
+                         _mm_cvtpd_ps(vdouble2(from.vh)));
+#else
+    vfloat4 to;
+
+    for (int i = 0; i < 4; ++i)
+      to[i] = from[i];
+
+    return to;
+#endif
+  }
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE vdouble8 convert_elements_to<double>(const vfloat8 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtps_pd(from);
+#else
+    return vdouble8(convert_elements_to<double>(vfloat4(from.vl)),
+                    convert_elements_to<double>(vfloat4(from.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat8 convert_elements_to<float>(const vdouble8 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtpd_ps(from);
+#else
+    return vfloat8(convert_elements_to<float>(vdouble4(from.vl)),
+                   convert_elements_to<float>(vdouble4(from.vh)));
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE vdouble16 convert_elements_to<double>(const vfloat16 &from)
+  {
+    return vdouble16(convert_elements_to<double>(vfloat8(from.vl)),
+                     convert_elements_to<double>(vfloat8(from.vh)));
+  }
+
+  template <>
+  TSIMD_INLINE vfloat16 convert_elements_to<float>(const vdouble16 &from)
+  {
+    return vfloat16(convert_elements_to<float>(vdouble8(from.vl)),
+                    convert_elements_to<float>(vdouble8(from.vh)));
+  }
+
+  // 8/16-bit integer <--> int conversions //
+
+  // NOTE(jda) - Widening sign/zero extends and narrowing truncates, matching
+  //             scalar conversion semantics.
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE vint8 convert_elements_to<int>(const vshort8 &from)
+  {
+#if defined(__AVX2__)
+    return _mm256_cvtepi16_epi32(from);
+#elif defined(__SSE4_1__)
+    return vint8(_mm_cvtepi16_epi32(from),
+                 _mm_cvtepi16_epi32(_mm_unpackhi_epi64(from, from)));
+#else
+    vint8 to;
+
+    for (int i = 0; i < 8; ++i)
+      to[i] = from[i];
+
+    return to;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint8 convert_elements_to<int>(const vushort8 &from)
+  {
+#if defined(__AVX2__)
+    return _mm256_cvtepu16_epi32(from);
+#elif defined(__SSE4_1__)
+    return vint8(_mm_cvtepu16_epi32(from),
+                 _mm_cvtepu16_epi32(_mm_unpackhi_epi64(from, from)));
+#else
+    vint8 to;
+
+    for (int i = 0; i < 8; ++i)
+      to[i] = from[i];
+
+    return to;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort8 convert_elements_to<int16_t>(const vint8 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cvtepi32_epi16(from);
+#elif defined(__AVX2__)
+    const __m256i lo = _mm256_and_si256(from, _mm256_set1_epi32(0xffff));
+    return _mm256_castsi256_si128(
+        _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, lo), 0x08));
+#elif defined(__SSE4_1__)
+    const __m128i m = _mm_set1_epi32(0xffff);
+    return _mm_packus_epi32(_mm_and_si128(from.vl, m),
+                            _mm_and_si128(from.vh, m));
+#else
+    vshort8 to;
+
+    for (int i = 0; i < 8; ++i)
+      to[i] = from[i];
+
+    return to;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort8 convert_elements_to<uint16_t>(const vint8 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cvtepi32_epi16(from);
+#elif defined(__AVX2__)
+    const __m256i lo = _mm256_and_si256(from, _mm256_set1_epi32(0xffff));
+    return _mm256_castsi256_si128(
+        _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, lo), 0x08));
+#elif defined(__SSE4_1__)
+    const __m128i m = _mm_set1_epi32(0xffff);
+    return _mm_packus_epi32(_mm_and_si128(from.vl, m),
+                            _mm_and_si128(from.vh, m));
+#else
+    vushort8 to;
+
+    for (int i = 0; i < 8; ++i)
+      to[i] = from[i];
+
+    return to;
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE vint16 convert_elements_to<int>(const vshort16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi16_epi32(from);
+#else
+    return vint16(convert_elements_to<int>(vshort8(from.vl)),
+                  convert_elements_to<int>(vshort8(from.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint16 convert_elements_to<int>(const vushort16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepu16_epi32(from);
+#else
+    return vint16(convert_elements_to<int>(vushort8(from.vl)),
+                  convert_elements_to<int>(vushort8(from.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint16 convert_elements_to<int>(const vschar16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi8_epi32(from);
+#elif defined(__AVX2__)
+    return vint16(_mm256_cvtepi8_epi32(from),
+                  _mm256_cvtepi8_epi32(_mm_unpackhi_epi64(from, from)));
+#else
+    vint16 to;
+
+    for (int i = 0; i < 16; ++i)
+      to[i] = from[i];
+
+    return to;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint16 convert_elements_to<int>(const vuchar16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepu8_epi32(from);
+#elif defined(__AVX2__)
+    return vint16(_mm256_cvtepu8_epi32(from),
+                  _mm256_cvtepu8_epi32(_mm_unpackhi_epi64(from, from)));
+#else
+    vint16 to;
+
+    for (int i = 0; i < 16; ++i)
+      to[i] = from[i];
+
+    return to;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort16 convert_elements_to<int16_t>(const vint16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi32_epi16(from);
+#else
+    return vshort16(convert_elements_to<int16_t>(vint8(from.vl)),
+                convert_elements_to<int16_t>(vint8(from.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort16 convert_elements_to<uint16_t>(const vint16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi32_epi16(from);
+#else
+    return vushort16(convert_elements_to<uint16_t>(vint8(from.vl)),
+                 convert_elements_to<uint16_t>(vint8(from.vh)));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vschar16 convert_elements_to<int8_t>(const vint16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi32_epi8(from);
+#elif defined(__AVX2__)
+    const __m256i m = _mm256_set1_epi32(0xff);
+    const __m256i w = _mm256_permute4x64_epi64(
+        _mm256_packus_epi32(_mm256_and_si256(from.vl, m),
+                            _mm256_and_si256(from.vh, m)),
+        0xd8);
+    return _mm_packus_epi16(_mm256_castsi256_si128(w),
+                            _mm256_extracti128_si256(w, 1));
+#else
+    vschar16 to;
+
+    for (int i = 0; i < 16; ++i)
+      to[i] = from[i];
+
+    return to;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar16 convert_elements_to<uint8_t>(const vint16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi32_epi8(from);
+#elif defined(__AVX2__)
+    const __m256i m = _mm256_set1_epi32(0xff);
+    const __m256i w = _mm256_permute4x64_epi64(
+        _mm256_packus_epi32(_mm256_and_si256(from.vl, m),
+                            _mm256_and_si256(from.vh, m)),
+        0xd8);
+    return _mm_packus_epi16(_mm256_castsi256_si128(w),
+                            _mm256_extracti128_si256(w, 1));
+#else
+    vuchar16 to;
+
+    for (int i = 0; i < 16; ++i)
+      to[i] = from[i];
+
+    return to;
+#endif
+  }
+
   // pack<> reinterpret_cast //////////////////////////////////////////////////
 
   //NOTE(jda) - ugly syntax here --> The return type is a
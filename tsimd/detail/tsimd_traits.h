@@ -24,10 +24,18 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
 #include "bool_t.h"
 #include "config.h"
 
 namespace tsimd {
+
+  template <typename T, int W>
+  struct pack;
+
   namespace traits {
 
     // C++14 traits for C++11 /////////////////////////////////////////////////
@@ -69,19 +77,47 @@ namespace tsimd {
     {
       static const bool value =
           std::is_same<T, float>::value || std::is_same<T, int>::value ||
+          std::is_same<T, unsigned int>::value ||
           std::is_same<T, bool32_t>::value || std::is_same<T, double>::value ||
-          std::is_same<T, long long>::value || std::is_same<T, bool64_t>::value;
+          std::is_same<T, long long>::value ||
+          std::is_same<T, bool64_t>::value || std::is_same<T, int8_t>::value ||
+          std::is_same<T, uint8_t>::value || std::is_same<T, bool8_t>::value ||
+          std::is_same<T, int16_t>::value || std::is_same<T, uint16_t>::value ||
+          std::is_same<T, bool16_t>::value;
     };
 
     template <typename T>
     using valid_type_for_pack_t = enable_if_t<valid_type_for_pack<T>::value>;
 
-    // If given type is a bool32_t or bool64_t ////////////////////////////////
+    // If a given W is a valid width for a pack<> of T ////////////////////////
+
+    // NOTE: widths without a native register are built out of two halves
+    //       (see half_simd_type<> below), so any power of two works
+
+    template <typename T, int W>
+    struct valid_width_for_pack
+    {
+      static const bool value = W > 0 && (W & (W - 1)) == 0;
+    };
+
+    // If a pack<> of width W is made out of two W/2 halves ///////////////////
+
+    template <int W>
+    struct has_halves
+    {
+      static const bool value = W > 1;
+    };
+
+    template <int W>
+    using has_halves_t = enable_if_t<has_halves<W>::value>;
+
+    // If given type is a bool8_t, bool16_t, bool32_t or bool64_t /////////////
 
     template <typename T>
     struct is_bool
     {
       static const bool value =
+          std::is_same<T, bool8_t>::value || std::is_same<T, bool16_t>::value ||
           std::is_same<T, bool32_t>::value || std::is_same<T, bool64_t>::value;
     };
 
@@ -118,6 +154,11 @@ namespace tsimd {
     template <typename T>
     using is_not_floating_point_t = enable_if_t<!is_floating_point<T>::value>;
 
+    // If given type is an integer type (not floating point or boolN_t) ///////
+
+    template <typename T>
+    using is_integral_t = enable_if_t<std::is_integral<T>::value>;
+
     // If given types are the same size ///////////////////////////////////////
 
     template <typename T1, typename T2>
@@ -142,6 +183,22 @@ namespace tsimd {
       using type = simd_undefined_type<T, W>;
     };
 
+    // NOTE: overloads on pointers, intrinsic types can't be template
+    //       arguments without dropping their attributes. Mask types forward
+    //       to the simd_undefined_type<> of their float/int type.
+
+    template <typename T, int W>
+    std::true_type simd_undefined_test(const simd_undefined_type<T, W> *);
+
+    std::false_type simd_undefined_test(const void *);
+
+    template <typename T, int W>
+    struct is_simd_undefined
+    {
+      static const bool value = decltype(
+          simd_undefined_test((typename simd_type<T, W>::type *)nullptr))::value;
+    };
+
     // bool types all widths //
 
     template <int W>
@@ -156,6 +213,18 @@ namespace tsimd {
       using type = typename simd_type<double, W>::type;
     };
 
+    template <int W>
+    struct simd_type<bool8_t, W>
+    {
+      using type = typename simd_type<int8_t, W>::type;
+    };
+
+    template <int W>
+    struct simd_type<bool16_t, W>
+    {
+      using type = typename simd_type<int16_t, W>::type;
+    };
+
     // 1-wide //
 
     template <>
@@ -170,6 +239,12 @@ namespace tsimd {
       using type = int;
     };
 
+    template <>
+    struct simd_type<unsigned int, 1>
+    {
+      using type = unsigned int;
+    };
+
     template <>
     struct simd_type<double, 1>
     {
@@ -182,6 +257,54 @@ namespace tsimd {
       using type = long long;
     };
 
+    template <>
+    struct simd_type<int8_t, 1>
+    {
+      using type = int8_t;
+    };
+
+    template <>
+    struct simd_type<uint8_t, 1>
+    {
+      using type = uint8_t;
+    };
+
+    template <>
+    struct simd_type<int16_t, 1>
+    {
+      using type = int16_t;
+    };
+
+    template <>
+    struct simd_type<uint16_t, 1>
+    {
+      using type = uint16_t;
+    };
+
+    // 2-wide //
+
+#if defined(__SSE__)
+    template <>
+    struct simd_type<double, 2>
+    {
+      using type = __m128d;
+    };
+
+    template <>
+    struct simd_type<long long, 2>
+    {
+      using type = __m128i;
+    };
+#endif
+
+#if defined(__AVX512VL__)
+    template <>
+    struct simd_type<bool64_t, 2>
+    {
+      using type = __mmask8;
+    };
+#endif
+
     // 4-wide //
 
 #if defined(__SSE__)
@@ -196,6 +319,12 @@ namespace tsimd {
     {
       using type = __m128i;
     };
+
+    template <>
+    struct simd_type<unsigned int, 4>
+    {
+      using type = __m128i;
+    };
 #endif
 
 #if defined(__AVX2__) || defined(__AVX__)
@@ -204,9 +333,7 @@ namespace tsimd {
     {
       using type = __m256d;
     };
-#endif
 
-#if defined(__AVX2__)
     template <>
     struct simd_type<long long, 4>
     {
@@ -214,6 +341,20 @@ namespace tsimd {
     };
 #endif
 
+#if defined(__AVX512VL__)
+    template <>
+    struct simd_type<bool32_t, 4>
+    {
+      using type = __mmask8;
+    };
+
+    template <>
+    struct simd_type<bool64_t, 4>
+    {
+      using type = __mmask8;
+    };
+#endif
+
     // 8-wide //
 
 #if defined(__AVX2__) || defined(__AVX__)
@@ -228,6 +369,54 @@ namespace tsimd {
     {
       using type = __m256i;
     };
+
+    template <>
+    struct simd_type<unsigned int, 8>
+    {
+      using type = __m256i;
+    };
+#endif
+
+#if defined(__AVX512F__)
+    template <>
+    struct simd_type<double, 8>
+    {
+      using type = __m512d;
+    };
+
+    template <>
+    struct simd_type<long long, 8>
+    {
+      using type = __m512i;
+    };
+
+    template <>
+    struct simd_type<bool64_t, 8>
+    {
+      using type = __mmask8;
+    };
+#endif
+
+#if defined(__AVX512VL__)
+    template <>
+    struct simd_type<bool32_t, 8>
+    {
+      using type = __mmask8;
+    };
+#endif
+
+#if defined(__SSE__)
+    template <>
+    struct simd_type<int16_t, 8>
+    {
+      using type = __m128i;
+    };
+
+    template <>
+    struct simd_type<uint16_t, 8>
+    {
+      using type = __m128i;
+    };
 #endif
 
     // 16-wide //
@@ -245,6 +434,12 @@ namespace tsimd {
       using type = __m512i;
     };
 
+    template <>
+    struct simd_type<unsigned int, 16>
+    {
+      using type = __m512i;
+    };
+
     template <>
     struct simd_type<bool32_t, 16>
     {
@@ -252,6 +447,155 @@ namespace tsimd {
     };
 #endif
 
+#if defined(__SSE__)
+    template <>
+    struct simd_type<int8_t, 16>
+    {
+      using type = __m128i;
+    };
+
+    template <>
+    struct simd_type<uint8_t, 16>
+    {
+      using type = __m128i;
+    };
+#endif
+
+#if defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct simd_type<int16_t, 16>
+    {
+      using type = __m256i;
+    };
+
+    template <>
+    struct simd_type<uint16_t, 16>
+    {
+      using type = __m256i;
+    };
+#endif
+
+    // 32-wide //
+
+#if defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct simd_type<int8_t, 32>
+    {
+      using type = __m256i;
+    };
+
+    template <>
+    struct simd_type<uint8_t, 32>
+    {
+      using type = __m256i;
+    };
+#endif
+
+#if defined(__AVX512F__)
+    template <>
+    struct simd_type<int16_t, 32>
+    {
+      using type = __m512i;
+    };
+
+    template <>
+    struct simd_type<uint16_t, 32>
+    {
+      using type = __m512i;
+    };
+#endif
+
+    // 64-wide //
+
+#if defined(__AVX512F__)
+    template <>
+    struct simd_type<int8_t, 64>
+    {
+      using type = __m512i;
+    };
+
+    template <>
+    struct simd_type<uint8_t, 64>
+    {
+      using type = __m512i;
+    };
+#endif
+
+    // If a pack<> of T with width W is an AVX-512 k-register mask ///////////
+
+    // NOTE: AVX512F makes vboolf16/vboold8 k-registers, AVX512VL adds the
+    //       4/8-wide float and 2/4-wide double masks. A __mmaskN is an
+    //       integer with one bit per element, so elements can't be accessed
+    //       through the boolN_t array.
+
+    template <typename T, int W>
+    struct is_kmask
+    {
+      static const bool value = false;
+    };
+
+#if defined(__AVX512F__)
+    template <>
+    struct is_kmask<bool32_t, 16>
+    {
+      static const bool value = true;
+    };
+
+    template <>
+    struct is_kmask<bool64_t, 8>
+    {
+      static const bool value = true;
+    };
+#endif
+
+#if defined(__AVX512VL__)
+    template <>
+    struct is_kmask<bool64_t, 2>
+    {
+      static const bool value = true;
+    };
+
+    template <>
+    struct is_kmask<bool32_t, 4>
+    {
+      static const bool value = true;
+    };
+
+    template <>
+    struct is_kmask<bool64_t, 4>
+    {
+      static const bool value = true;
+    };
+
+    template <>
+    struct is_kmask<bool32_t, 8>
+    {
+      static const bool value = true;
+    };
+#endif
+
+    // Width of the k-register masks holding the elements of a pack<T, W> /////
+
+    // NOTE: evaluates to W for a k-register mask, to the width of its
+    //       k-register halves for a composite mask (ex: vboolf32 on AVX-512
+    //       is made of two __mmask16), or to 0 otherwise
+
+    template <typename T, int W>
+    struct kmask_width
+    {
+      static const int value =
+          is_kmask<T, W>::value
+              ? W
+              : (is_simd_undefined<T, W>::value ? kmask_width<T, W / 2>::value
+                                                : 0);
+    };
+
+    template <typename T>
+    struct kmask_width<T, 1>
+    {
+      static const int value = 0;
+    };
+
     // Check if a pack<T, W>::intrinsic_t is actually an intrinsic type ///////
 
     // example: pack<float, 8> on AVX is type __m256, so evaluate to "true"
@@ -295,6 +639,12 @@ namespace tsimd {
       using type = simd_type<float, 1>::type;
     };
 
+    template <>
+    struct cast_simd_type<unsigned int, 1>
+    {
+      using type = simd_type<float, 1>::type;
+    };
+
     template <>
     struct cast_simd_type<double, 1>
     {
@@ -307,6 +657,28 @@ namespace tsimd {
       using type = simd_type<double, 1>::type;
     };
 
+    // 2-wide //
+
+    template <>
+    struct cast_simd_type<double, 2>
+    {
+      using type = simd_type<long long, 2>::type;
+    };
+
+    template <>
+    struct cast_simd_type<long long, 2>
+    {
+      using type = simd_type<double, 2>::type;
+    };
+
+#if !defined(__AVX512VL__)
+    template <>
+    struct cast_simd_type<bool64_t, 2>
+    {
+      using type = simd_type<long long, 2>::type;
+    };
+#endif
+
     // 4-wide //
 
     template <>
@@ -321,11 +693,39 @@ namespace tsimd {
       using type = simd_type<float, 4>::type;
     };
 
+    template <>
+    struct cast_simd_type<unsigned int, 4>
+    {
+      using type = simd_type<float, 4>::type;
+    };
+
+#if !defined(__AVX512VL__)
     template <>
     struct cast_simd_type<bool32_t, 4>
     {
       using type = simd_type<int, 4>::type;
     };
+#endif
+
+    template <>
+    struct cast_simd_type<double, 4>
+    {
+      using type = simd_type<long long, 4>::type;
+    };
+
+    template <>
+    struct cast_simd_type<long long, 4>
+    {
+      using type = simd_type<double, 4>::type;
+    };
+
+#if !defined(__AVX512VL__)
+    template <>
+    struct cast_simd_type<bool64_t, 4>
+    {
+      using type = simd_type<long long, 4>::type;
+    };
+#endif
 
     // 8-wide //
 
@@ -341,11 +741,31 @@ namespace tsimd {
       using type = simd_type<float, 8>::type;
     };
 
+    template <>
+    struct cast_simd_type<unsigned int, 8>
+    {
+      using type = simd_type<float, 8>::type;
+    };
+
+#if !defined(__AVX512VL__)
     template <>
     struct cast_simd_type<bool32_t, 8>
     {
       using type = simd_type<int, 8>::type;
     };
+#endif
+
+    template <>
+    struct cast_simd_type<double, 8>
+    {
+      using type = simd_type<long long, 8>::type;
+    };
+
+    template <>
+    struct cast_simd_type<long long, 8>
+    {
+      using type = simd_type<double, 8>::type;
+    };
 
     // 16-wide //
 
@@ -361,12 +781,35 @@ namespace tsimd {
       using type = simd_type<float, 16>::type;
     };
 
+    template <>
+    struct cast_simd_type<unsigned int, 16>
+    {
+      using type = simd_type<float, 16>::type;
+    };
+
     // Provide intrinsic type half the size of given width ////////////////////
 
+    // NOTE: by default the halves are the native W/2 register if there is
+    //       one, otherwise a W/2 pack<> (which is itself split in halves)
+
+    template <typename T,
+              int W,
+              bool = W == 2 || is_simd_undefined<T, W / 2>::value>
+    struct default_half_simd_type
+    {
+      using type = typename simd_type<T, W / 2>::type;
+    };
+
+    template <typename T, int W>
+    struct default_half_simd_type<T, W, true>
+    {
+      using type = pack<T, W / 2>;
+    };
+
     template <typename T, int W>
     struct half_simd_type
     {
-      using type = std::array<T, W / 2>;
+      using type = typename default_half_simd_type<T, W>::type;
     };
 
     // 1-wide //
@@ -377,6 +820,46 @@ namespace tsimd {
       using type = std::array<T, 1>;
     };
 
+    // 2-wide //
+
+#if defined(__AVX512VL__)
+    template <>
+    struct half_simd_type<bool64_t, 2>
+    {
+      using type = simd_undefined_type<bool64_t, 1>;
+    };
+#endif
+
+    // 4-wide //
+
+#if defined(__AVX__)
+    template <>
+    struct half_simd_type<double, 4>
+    {
+      using type = __m128d;
+    };
+
+    template <>
+    struct half_simd_type<long long, 4>
+    {
+      using type = __m128i;
+    };
+#endif
+
+#if defined(__AVX512VL__)
+    template <>
+    struct half_simd_type<bool64_t, 4>
+    {
+      using type = simd_undefined_type<bool64_t, 2>;
+    };
+#elif defined(__AVX__)
+    template <>
+    struct half_simd_type<bool64_t, 4>
+    {
+      using type = half_simd_type<double, 4>::type;
+    };
+#endif
+
     // 8-wide //
 
 #if defined(__SSE__)
@@ -392,6 +875,20 @@ namespace tsimd {
       using type = simd_type<int, 4>::type;
     };
 
+    template <>
+    struct half_simd_type<unsigned int, 8>
+    {
+      using type = simd_type<unsigned int, 4>::type;
+    };
+#endif
+
+#if defined(__AVX512VL__)
+    template <>
+    struct half_simd_type<bool32_t, 8>
+    {
+      using type = simd_undefined_type<bool32_t, 4>;
+    };
+#elif defined(__SSE__)
     template <>
     struct half_simd_type<bool32_t, 8>
     {
@@ -399,6 +896,34 @@ namespace tsimd {
     };
 #endif
 
+#if defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct half_simd_type<double, 8>
+    {
+      using type = simd_type<double, 4>::type;
+    };
+
+    template <>
+    struct half_simd_type<long long, 8>
+    {
+      using type = simd_type<long long, 4>::type;
+    };
+#endif
+
+#if defined(__AVX512F__)
+    template <>
+    struct half_simd_type<bool64_t, 8>
+    {
+      using type = simd_undefined_type<bool64_t, 4>;
+    };
+#elif defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct half_simd_type<bool64_t, 8>
+    {
+      using type = half_simd_type<double, 8>::type;
+    };
+#endif
+
     // 16-wide //
 
 #if defined(__AVX2__) || defined(__AVX__)
@@ -407,7 +932,15 @@ namespace tsimd {
     {
       using type = simd_type<float, 8>::type;
     };
+#endif
 
+#if defined(__AVX512F__)
+    template <>
+    struct half_simd_type<bool32_t, 16>
+    {
+      using type = simd_undefined_type<bool32_t, 8>;
+    };
+#elif defined(__AVX2__) || defined(__AVX__)
     template <>
     struct half_simd_type<bool32_t, 16>
     {
@@ -421,26 +954,120 @@ namespace tsimd {
     {
       using type = simd_type<int, 8>::type;
     };
+
+    template <>
+    struct half_simd_type<unsigned int, 16>
+    {
+      using type = simd_type<unsigned int, 8>::type;
+    };
 #endif
 
-    // Provide half_simd_type is a std::array<T, W/2> /////////////////////////
+#if defined(__AVX512F__)
+    template <>
+    struct half_simd_type<double, 16>
+    {
+      using type = simd_type<double, 8>::type;
+    };
 
-    template <typename T, int W>
-    struct half_simd_is_array
+    template <>
+    struct half_simd_type<long long, 16>
     {
-      static const bool value =
-          std::is_same<typename half_simd_type<T, W>::type,
-                       std::array<T, W / 2>>::value;
+      using type = simd_type<long long, 8>::type;
     };
 
-    template <typename T>
-    struct half_simd_is_array<T, 1>
+    template <>
+    struct half_simd_type<bool64_t, 16>
     {
-      static const bool value =
-          std::is_same<typename half_simd_type<T, 1>::type,
-                       std::array<T, 1>>::value;
+      using type = simd_type<bool64_t, 8>::type;
+    };
+#endif
+
+    // 16-wide (8/16-bit elements) //
+
+#if defined(__SSE__)
+    template <>
+    struct half_simd_type<int16_t, 16>
+    {
+      using type = simd_type<int16_t, 8>::type;
+    };
+
+    template <>
+    struct half_simd_type<uint16_t, 16>
+    {
+      using type = simd_type<uint16_t, 8>::type;
+    };
+
+    template <>
+    struct half_simd_type<bool16_t, 16>
+    {
+      using type = half_simd_type<int16_t, 16>::type;
+    };
+#endif
+
+    // 32-wide //
+
+#if defined(__SSE__)
+    template <>
+    struct half_simd_type<int8_t, 32>
+    {
+      using type = simd_type<int8_t, 16>::type;
+    };
+
+    template <>
+    struct half_simd_type<uint8_t, 32>
+    {
+      using type = simd_type<uint8_t, 16>::type;
+    };
+
+    template <>
+    struct half_simd_type<bool8_t, 32>
+    {
+      using type = half_simd_type<int8_t, 32>::type;
+    };
+#endif
+
+#if defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct half_simd_type<int16_t, 32>
+    {
+      using type = simd_type<int16_t, 16>::type;
+    };
+
+    template <>
+    struct half_simd_type<uint16_t, 32>
+    {
+      using type = simd_type<uint16_t, 16>::type;
     };
 
+    template <>
+    struct half_simd_type<bool16_t, 32>
+    {
+      using type = half_simd_type<int16_t, 32>::type;
+    };
+#endif
+
+    // 64-wide //
+
+#if defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct half_simd_type<int8_t, 64>
+    {
+      using type = simd_type<int8_t, 32>::type;
+    };
+
+    template <>
+    struct half_simd_type<uint8_t, 64>
+    {
+      using type = simd_type<uint8_t, 32>::type;
+    };
+
+    template <>
+    struct half_simd_type<bool8_t, 64>
+    {
+      using type = half_simd_type<int8_t, 64>::type;
+    };
+#endif
+
     // Bool type for given primitive type /////////////////////////////////////
 
     template <typename T>
@@ -454,6 +1081,46 @@ namespace tsimd {
       using type = bool_undefined_type<T>;
     };
 
+    // 8-bit //
+
+    template <>
+    struct bool_type_for<int8_t>
+    {
+      using type = bool8_t;
+    };
+
+    template <>
+    struct bool_type_for<uint8_t>
+    {
+      using type = bool8_t;
+    };
+
+    template <>
+    struct bool_type_for<bool8_t>
+    {
+      using type = bool8_t;
+    };
+
+    // 16-bit //
+
+    template <>
+    struct bool_type_for<int16_t>
+    {
+      using type = bool16_t;
+    };
+
+    template <>
+    struct bool_type_for<uint16_t>
+    {
+      using type = bool16_t;
+    };
+
+    template <>
+    struct bool_type_for<bool16_t>
+    {
+      using type = bool16_t;
+    };
+
     // 32-bit //
 
     template <>
@@ -468,6 +1135,12 @@ namespace tsimd {
       using type = bool32_t;
     };
 
+    template <>
+    struct bool_type_for<unsigned int>
+    {
+      using type = bool32_t;
+    };
+
     template <>
     struct bool_type_for<bool32_t>
     {
@@ -26,6 +26,8 @@
 
 #include "detail/pack.h"
 
+#include "detail/dispatch.h"
+
 #include "detail/functions/algorithm.h"
 #include "detail/functions/math.h"
 #include "detail/functions/memory.h"
@@ -34,3 +36,5 @@
 #include "detail/operators/arithmetic.h"
 #include "detail/operators/bitwise.h"
 #include "detail/operators/logic.h"
+
+#include "detail/divider.h"